@@ -0,0 +1,54 @@
+# Benchmark suite of TheAlgorithms.jl
+#
+# `SUITE` follows the PkgBenchmark.jl conventions, so it can be run with
+# `PkgBenchmark.benchmarkpkg("TheAlgorithms")`, or checked against the stored
+# baseline with `benchmark/compare.jl`.
+#
+# Every group is tagged with its own name and is laid out as
+# SUITE[group][function][eltype][size].
+
+using BenchmarkTools: BenchmarkGroup, @benchmarkable
+using LinearAlgebra: I
+using Random
+using StaticArrays: @SMatrix, SVector
+using TheAlgorithms
+
+const RNG = MersenneTwister(0x5eed)
+
+# Inputs stop at BENCHMARK_MAX_SIZE elements, 10^7 by default (at most 10^8)
+const MAX_SIZE = parse(Int, get(ENV, "BENCHMARK_MAX_SIZE", "10000000"))
+const SIZES = filter(<=(MAX_SIZE), [10^2, 10^3, 10^4, 10^5, 10^6, 10^7, 10^8])
+# Quadratic (or worse) algorithms stop at 10^4, a single sample takes minutes beyond that
+const QUADRATIC_SIZES = filter(<=(10^4), SIZES)
+const ELTYPES = (Int64, Float64, Float32)
+
+const SUITE = BenchmarkGroup()
+
+"""
+    group!(keys...)
+
+Returns the nested group `SUITE[keys...]`, creating the missing levels.
+"""
+function group!(keys...)
+    g = SUITE
+    for k in keys
+        k = string(k)
+        if !haskey(g, k)
+            g[k] = BenchmarkGroup(g === SUITE ? [k] : String[])
+        end
+        g = g[k]
+    end
+    return g
+end
+
+include("conversions.jl")
+include("data_structures.jl")
+include("knapsack.jl")
+include("math.jl")
+include("matrix.jl")
+include("project-rosalind.jl")
+include("scheduling.jl")
+include("searches.jl")
+include("sorts.jl")
+include("statistics.jl")
+include("strings.jl")
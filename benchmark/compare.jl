@@ -0,0 +1,105 @@
+# Runs the benchmark suite and compares the results with the stored baseline.
+#
+# Usage, from the root of the repository:
+#
+#     julia --project=benchmark benchmark/compare.jl [options] [group ...]
+#
+# Options:
+#  - `--save`: store the results as the new baseline instead of comparing them
+#  - `--baseline=file`: baseline file (default: benchmark/baseline.json)
+#  - `--tolerance=x`: relative change of time/memory tolerated before a
+#    benchmark is flagged (default: 0.05)
+#  - `group ...`: only run these top-level groups, e.g. `sorts searches`
+#
+# The script exits with status 1 when at least one benchmark regressed.
+
+import BenchmarkTools
+import Statistics
+
+include(joinpath(@__DIR__, "benchmarks.jl"))
+
+function parse_arguments(args)
+    options = Dict{String,String}(
+        "baseline" => joinpath(@__DIR__, "baseline.json"),
+        "tolerance" => "0.05",
+    )
+    save = false
+    groups = String[]
+    for arg in args
+        if arg == "--save"
+            save = true
+        elseif startswith(arg, "--") && occursin('=', arg)
+            key, value = split(arg[3:end], '='; limit = 2)
+            haskey(options, key) || error("Unknown option: --$key")
+            options[key] = value
+        else
+            push!(groups, arg)
+        end
+    end
+    return save, options["baseline"], parse(Float64, options["tolerance"]), groups
+end
+
+"""
+    lookup(group, path)
+
+Returns the entry of the nested `group` at `path`, or `nothing` if there is none.
+"""
+function lookup(group, path)
+    for key in path
+        haskey(group, key) || return nothing
+        group = group[key]
+    end
+    return group
+end
+
+function compare(results, baseline, tolerance)
+    regressed = 0
+    for (path, estimate) in sort!(BenchmarkTools.leaves(results); by = p -> join(first(p), '/'))
+        name = join(path, '/')
+        old = lookup(baseline, path)
+        if old === nothing
+            println("new         ", name, "  ", BenchmarkTools.prettytime(BenchmarkTools.time(estimate)))
+            continue
+        end
+        judgement = BenchmarkTools.judge(estimate, old; time_tolerance = tolerance, memory_tolerance = tolerance)
+        ratio = BenchmarkTools.ratio(judgement)
+        status = BenchmarkTools.isregression(judgement) ? "REGRESSION" :
+                 BenchmarkTools.isimprovement(judgement) ? "improvement" : "invariant"
+        status == "REGRESSION" && (regressed += 1)
+        println(
+            rpad(status, 12), name,
+            "  time ×", round(BenchmarkTools.time(ratio); digits = 3),
+            "  memory ×", round(BenchmarkTools.memory(ratio); digits = 3),
+        )
+    end
+    return regressed
+end
+
+function main(args)
+    save, baseline_file, tolerance, groups = parse_arguments(args)
+
+    suite = SUITE
+    if !isempty(groups)
+        suite = BenchmarkTools.BenchmarkGroup()
+        for g in groups
+            suite[g] = SUITE[g]
+        end
+    end
+
+    BenchmarkTools.tune!(suite)
+    results = Statistics.median(run(suite; verbose = true))
+
+    if save
+        BenchmarkTools.save(baseline_file, results)
+        println("Baseline written to ", baseline_file)
+        return 0
+    end
+
+    isfile(baseline_file) || error("No baseline at $baseline_file, create one with --save")
+    baseline = BenchmarkTools.load(baseline_file)[1]
+    regressed = compare(results, baseline, tolerance)
+    println(regressed, " regression(s)")
+    return regressed == 0 ? 0 : 1
+end
+
+exit(main(ARGS))
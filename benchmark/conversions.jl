@@ -0,0 +1,29 @@
+# Conversions are scalar, the sizes are the lengths of the broadcast inputs
+for T in (Float64, Float32), n in SIZES
+    x = rand(RNG, T, n) .* 100
+    out = similar(x)
+
+    for (name, f, f!) in (
+        ("celsius_to_fahrenheit", celsius_to_fahrenheit, celsius_to_fahrenheit!),
+        ("celsius_to_kelvin", celsius_to_kelvin, celsius_to_kelvin!),
+        ("fahrenheit_to_celsius", fahrenheit_to_celsius, fahrenheit_to_celsius!),
+        ("fahrenheit_to_kelvin", fahrenheit_to_kelvin, fahrenheit_to_kelvin!),
+        ("kelvin_to_celsius", kelvin_to_celsius, kelvin_to_celsius!),
+        ("kelvin_to_fahrenheit", kelvin_to_fahrenheit, kelvin_to_fahrenheit!),
+    )
+        group!("conversions", name, T)[string(n)] =
+            @benchmarkable $f.($x)
+        group!("conversions", name * "!", T)[string(n)] =
+            @benchmarkable $f!($out, $x)
+    end
+
+    # two conversions fused into one pass
+    c = conversion(Kelvin(), Fahrenheit()) ∘ conversion(Celsius(), Kelvin())
+    group!("conversions", "convert_unit!", T)[string(n)] =
+        @benchmarkable convert_unit!($out, $x, $c)
+
+    group!("conversions", "weight_conversion", T)[string(n)] =
+        @benchmarkable weight_conversion.("kilogram", "pound", $x)
+    group!("conversions", "weight_conversion!", T)[string(n)] =
+        @benchmarkable weight_conversion!($out, "kilogram", "pound", $x)
+end
@@ -0,0 +1,63 @@
+# Counts the elementary operations of some algorithms with the instrumentation
+# of the package, which unlike the timings of the suite do not depend on the
+# machine: comparisons and swaps of the sorts, probes of the searches on
+# uniform and skewed keys, steps of DisjointSet finds and knapsack table updates.
+#
+# Usage, from the root of the repository:
+#
+#     julia --project=benchmark benchmark/counts.jl [--json]
+
+using Random
+using TheAlgorithms
+
+enable_instrumentation()
+
+const N = 10^5
+
+"""
+    counts(f)
+
+Counters of the instrumentation after running `f()` from zero.
+"""
+function counts(f)
+    reset_instrumentation!()
+    f()
+    return instrumentation_counts()
+end
+
+function main(args)
+    rng = MersenneTwister(0x5eed)
+    x = rand(rng, N)
+    uniform = collect(1:3:3N)
+    skewed = [1.0001^i for i in 1:N]
+    queries = rand(rng, 1:N, 1000)
+    edges = [(rand(rng, 1:N), rand(rng, 1:N)) for _ in 1:N]
+
+    results = [
+        "QuickSort!" => counts(() -> QuickSort!(copy(x))),
+        "MergeSort!" => counts(() -> MergeSort!(copy(x))),
+        "ParallelSort!" => counts(() -> ParallelSort!(copy(x))),
+        "binary_search (uniform)" => counts(() -> foreach(i -> binary_search(uniform, uniform[i]; check_sorted = false), queries)),
+        "interpolation_search (uniform)" => counts(() -> foreach(i -> interpolation_search(uniform, uniform[i]), queries)),
+        "interpolation_search (skewed)" => counts(() -> foreach(i -> interpolation_search(skewed, skewed[i]), queries)),
+        "jump_search (uniform)" => counts(() -> foreach(i -> jump_search(uniform, uniform[i]), queries)),
+        "DisjointSet merge!" => counts(() -> merge!(DisjointSet(N), edges)),
+        "zero_one_pack!" => counts(() -> zero_one_pack!(10^4, rand(rng, 1:1000, 100), rand(rng, 1:1000, 100), zeros(Int, 10^4))),
+    ]
+
+    if "--json" in args
+        println("{")
+        for (i, (name, c)) in enumerate(results)
+            fields = join(("\"$k\": $(c[k])" for k in keys(c) if c[k] != 0), ", ")
+            println("  \"$name\": {", fields, "}", i < length(results) ? "," : "")
+        end
+        println("}")
+    else
+        for (name, c) in results
+            println(rpad(name, 32), join(("$k = $(c[k])" for k in keys(c) if c[k] != 0), ", "))
+        end
+    end
+    return 0
+end
+
+exit(main(ARGS))
@@ -0,0 +1,44 @@
+for n in SIZES
+    edges = [(rand(RNG, 1:n), rand(RNG, 1:n)) for _ in 1:n]
+
+    group!("data_structures", "DisjointSet", Int64)[string(n)] = @benchmarkable begin
+        set = DisjointSet($n)
+        for (x, y) in $edges
+            merge!(set, x, y)
+        end
+        find(set, 1)
+    end
+    group!("data_structures", "ConcurrentDisjointSet", Int64)[string(n)] = @benchmarkable begin
+        set = ConcurrentDisjointSet($n)
+        merge!(set, $edges)
+        num_sets(set)
+    end
+
+    # heap shaped tree: node i hangs below node i ÷ 2
+    group!("data_structures", "BinaryTree", Int64)[string(n)] = @benchmarkable begin
+        tree = BinaryTree{Int}($n, 1)
+        for i in 2:$n
+            insert!(tree, i ÷ 2, i)
+        end
+        height(tree)
+    end
+    sorted_values = collect(1:n)
+    group!("data_structures", "BinaryTree", Int64)["bulk/$n"] = @benchmarkable BinaryTree($sorted_values)
+    group!("data_structures", "BinaryTree", Int64)["inorder/$n"] =
+        @benchmarkable sum(i -> tree.val[i], inorder(tree)) setup = (tree = BinaryTree($sorted_values))
+    group!("data_structures", "BinaryTree", Int64)["inorder compacted/$n"] =
+        @benchmarkable sum(i -> tree.val[i], inorder(tree)) setup = (tree = compact!(BinaryTree($sorted_values)))
+
+    random_keys = rand(RNG, 1:10n, n)
+    group!("data_structures", "OrderedIndex", Int64)["insert!/$n"] = @benchmarkable begin
+        index = OrderedIndex{Int,Int}()
+        for k in $random_keys
+            index[k] = k
+        end
+        length(index)
+    end
+    group!("data_structures", "OrderedIndex", Int64)["get/$n"] =
+        @benchmarkable sum(k -> get(index, k, 0), $random_keys) setup = (index = OrderedIndex($sorted_values, $sorted_values))
+    group!("data_structures", "OrderedIndex", Int64)["scan/$n"] =
+        @benchmarkable sum(p -> p.second, scan(index, 1, $(n ÷ 2))) setup = (index = OrderedIndex($sorted_values, $sorted_values))
+end
@@ -0,0 +1,13 @@
+# The sizes are capacities, every instance has 50 items
+for n in filter(<=(10^6), SIZES)
+    weights = rand(RNG, 1:max(1, n ÷ 10), 50)
+    values = rand(RNG, 1:1000, 50)
+
+    group!("knapsack", "zero_one_pack!", Int64)[string(n)] =
+        @benchmarkable zero_one_pack!($n, $weights, $values, dp) setup = (dp = zeros(Int, $n)) evals = 1
+    group!("knapsack", "complete_pack!", Int64)[string(n)] =
+        @benchmarkable complete_pack!($n, $weights, $values, dp) setup = (dp = zeros(Int, $n)) evals = 1
+    group!("knapsack", "knapsack!", Int64)[string(n)] =
+        @benchmarkable knapsack!(solver, $n, $weights, $values) setup = (solver = KnapsackSolver()) evals = 1
+    group!("knapsack", "subset_sums", Int64)[string(n)] = @benchmarkable subset_sums($n, $weights)
+end
@@ -0,0 +1,141 @@
+# Vector inputs
+for T in (Int64, Float64), n in SIZES
+    x = T == Int64 ? rand(RNG, -1000:1000, n) : randn(RNG, n) .* 1000
+
+    group!("math", "abs_max", T)[string(n)] = @benchmarkable abs_max($x)
+    group!("math", "abs_min", T)[string(n)] = @benchmarkable abs_min($x)
+    group!("math", "abs_val", T)[string(n)] = @benchmarkable abs_val.($x)
+    group!("math", "ceil_val", T)[string(n)] = @benchmarkable ceil_val.($x)
+    group!("math", "floor_val", T)[string(n)] = @benchmarkable floor_val.($x)
+    group!("math", "mean", T)[string(n)] = @benchmarkable mean($x)
+    group!("math", "median", T)[string(n)] = @benchmarkable median($x)
+    group!("math", "median!", T)[string(n)] = @benchmarkable median!(y) setup = (y = copy($x)) evals = 1
+    group!("math", "quantile!", T)[string(n)] = @benchmarkable quantile!(y, 0.99) setup = (y = copy($x)) evals = 1
+    group!("math", "mode", T)[string(n)] = @benchmarkable mode($x)
+    group!("math", "mode!", T)[string(n)] = @benchmarkable (reset!(ws); mode!(ws, $x)) setup = (ws = Workspace())
+end
+
+# Scalar predicates, over 1:n
+for n in SIZES
+    r = collect(1:n)
+
+    group!("math", "is_armstrong", Int64)[string(n)] = @benchmarkable map_predicate(is_armstrong, $r)
+    group!("math", "perfect_cube", Int64)[string(n)] = @benchmarkable map_predicate(perfect_cube, $r)
+    group!("math", "perfect_square", Int64)[string(n)] = @benchmarkable map_predicate(perfect_square, $r)
+    group!("math", "perfect_numbers", Int64)[string(n)] = @benchmarkable perfect_numbers($(1:n))
+    group!("math", "collatz_stopping_times", Int64)[string(n)] = @benchmarkable collatz_stopping_times($(1:n))
+end
+
+# Geometry, broadcast over n shapes
+for n in SIZES
+    a = rand(RNG, n) .+ 1
+    b = rand(RNG, n) .+ 1
+    c = a .+ b .- 0.5 # keeps (a, b, c) a valid triangle
+
+    g = group!("math", "area", Float64)
+    g["surfarea_cube/$n"] = @benchmarkable surfarea_cube.($a)
+    g["surfarea_sphere/$n"] = @benchmarkable surfarea_sphere.($a)
+    g["area_rectangle/$n"] = @benchmarkable area_rectangle.($a, $b)
+    g["area_square/$n"] = @benchmarkable area_square.($a)
+    g["area_triangle/$n"] = @benchmarkable area_triangle.($a, $b)
+    g["area_heron_triangle/$n"] = @benchmarkable area_heron_triangle.($a, $b, $c)
+    g["area_parallelogram/$n"] = @benchmarkable area_parallelogram.($a, $b)
+    g["area_trapezium/$n"] = @benchmarkable area_trapezium.($a, $b, $c)
+    g["area_circle/$n"] = @benchmarkable area_circle.($a)
+    g["area_ellipse/$n"] = @benchmarkable area_ellipse.($a, $b)
+    g["area_rhombus/$n"] = @benchmarkable area_rhombus.($a, $b)
+
+    out = similar(a)
+    g = group!("math", "area!", Float64)
+    g["surfarea_sphere!/$n"] = @benchmarkable surfarea_sphere!($out, $a)
+    g["area_rectangle!/$n"] = @benchmarkable area_rectangle!($out, $a, $b)
+    g["area_heron_triangle!/$n"] = @benchmarkable area_heron_triangle!($out, $a, $b, $c)
+    g["area_trapezium!/$n"] = @benchmarkable area_trapezium!($out, $a, $b, $c)
+    g["area_ellipse!/$n"] = @benchmarkable area_ellipse!($out, $a, $b)
+
+    # n/8 octagons, by their vertices in a row
+    θ = repeat(range(0, 2π, length = 9)[1:8], cld(n, 8))
+    offsets = collect(1:8:length(θ)+1)
+    group!("math", "area_polygon!", Float64)[string(n)] =
+        @benchmarkable area_polygon!($(zeros(length(offsets) - 1)), $(cos.(θ)), $(sin.(θ)), $offsets)
+end
+
+# The sizes are step counts
+for n in SIZES
+    group!("math", "trapazoidal_area", Float64)[string(n)] =
+        @benchmarkable trapazoidal_area(sin, 0, π, $n)
+    group!("math", "line_length", Float64)[string(n)] =
+        @benchmarkable line_length(sin, 0, π, $n)
+    x = range(0, π, length = n + 1)
+    group!("math", "line_length(x, y)", Float64)[string(n)] = @benchmarkable line_length($x, $(sin.(x)))
+    group!("math", "euler_method", Float64)[string(n)] =
+        @benchmarkable euler_method((x, t) -> -x, 1.0, (0.0, 1.0), $(1 / n))
+    y = sin.(range(0, π, length = n + 1))
+    group!("math", "trapezoid", Float64)[string(n)] = @benchmarkable trapezoid($y, $(π / n))
+    group!("math", "simpson", Float64)[string(n)] = @benchmarkable simpson($y, $(π / n))
+end
+
+# Adaptive quadrature, and batches of n curves of 33 samples or n intervals
+let g = group!("math", "adaptive quadrature", Float64)
+    g["gauss_kronrod"] = @benchmarkable gauss_kronrod(x -> exp(-x^2), -10, 10)
+    g["gauss_kronrod/singular"] = @benchmarkable gauss_kronrod(x -> 1 / sqrt(x), 0, 1)
+    g["romberg"] = @benchmarkable romberg(x -> exp(-x^2), -10, 10)
+end
+for n in filter(<=(10^6), SIZES)
+    Y = rand(RNG, 33, n)
+    out = zeros(n)
+    group!("math", "simpson!", Float64)[string(n)] = @benchmarkable simpson!($out, $Y, 0.1)
+    a = rand(RNG, n)
+    group!("math", "gauss_kronrod!", Float64)[string(n)] = @benchmarkable gauss_kronrod!($out, exp, $a, $(a .+ 1))
+end
+
+# The sizes are step counts for the fixed steps, and ensemble sizes
+let u0 = [7900000.0, 10.0, 0.0], p = [0.5 / 7900000.0, 0.33]
+    for n in filter(<=(10^6), SIZES)
+        h = 140 / n
+        group!("math", "solve_ode!_euler", Float64)[string(n)] =
+            @benchmarkable solve_ode!((t, u) -> nothing, $(ForwardEuler(h)), SIR, $u0, (0.0, 140.0), $p; cache = $(ode_cache(u0)))
+        group!("math", "solve_ode!_rk4", Float64)[string(n)] =
+            @benchmarkable solve_ode!((t, u) -> nothing, $(RungeKutta4(h)), SIR, $u0, (0.0, 140.0), $p; cache = $(ode_cache(u0)))
+        group!("math", "solve_ode!_rk4_static", Float64)[string(n)] =
+            @benchmarkable solve_ode!((t, u) -> nothing, $(RungeKutta4(h)), SIR, $(SVector{3}(u0)), (0.0, 140.0), $(SVector{2}(p)))
+    end
+    group!("math", "solve_sir", Float64)["100"] = @benchmarkable solve_sir($u0, (0.0, 140.0), $p)
+    for n in filter(<=(10^5), SIZES)
+        ps = [SVector(b / 7900000.0, 0.33) for b in range(0.3, 0.6, length = n)]
+        us = Vector{SVector{3,Float64}}(undef, n)
+        group!("math", "solve_ensemble!", Float64)[string(n)] =
+            @benchmarkable solve_ensemble!($us, $(DormandPrince()), SIR, $(SVector{3}(u0)), (0.0, 140.0), $ps)
+    end
+end
+
+# The sizes are the arguments themselves
+const PRIMES = Dict(10^2 => 101, 10^3 => 1009, 10^4 => 10007, 10^5 => 100003, 10^6 => 1000003, 10^7 => 10000019, 10^8 => 100000007)
+for n in SIZES
+    group!("math", "prime_check", Int64)[string(n)] = @benchmarkable prime_check($(PRIMES[n]))
+    group!("math", "prime_factors", Int64)[string(n)] = @benchmarkable prime_factors($(n - 1))
+    group!("math", "collatz_sequence", Int64)[string(n)] = @benchmarkable collatz_sequence($(n + 1))
+    group!("math", "prime_factors!", Int64)[string(n)] = @benchmarkable (reset!(ws); prime_factors!(ws, $(n - 1))) setup = (ws = Workspace())
+    group!("math", "collatz_sequence!", Int64)[string(n)] = @benchmarkable (reset!(ws); collatz_sequence!(ws, $(n + 1))) setup = (ws = Workspace())
+    group!("math", "perfect_number", Int64)[string(n)] = @benchmarkable perfect_number($n)
+end
+group!("math", "PrimeTable", Int64)[string(MAX_SIZE)] = @benchmarkable PrimeTable($MAX_SIZE)
+let g = group!("math", "64-bit", Int64)
+    g["prime_check"] = @benchmarkable prime_check($(2^61 - 1))
+    g["prime_factors"] = @benchmarkable prime_factors($(1000000007 * 998244353))
+end
+for n in QUADRATIC_SIZES
+    group!("math", "factorial_iterative", Int64)[string(n)] = @benchmarkable factorial_iterative($n)
+    group!("math", "factorial_fast", Int64)[string(n)] = @benchmarkable factorial_fast($n)
+end
+group!("math", "factorial_fast", Int64)["1000000"] = @benchmarkable factorial_fast(1000000)
+for n in filter(<=(10^3), SIZES) # deeper recursion overflows the stack
+    group!("math", "factorial_recursive", Int64)[string(n)] = @benchmarkable factorial_recursive($n)
+end
+
+# Formulas
+let g = group!("math", "formulas", Float64)
+    g["sum_ap"] = @benchmarkable sum_ap($(rand(RNG)), $(rand(RNG)), 1000)
+    g["sum_gp"] = @benchmarkable sum_gp($(rand(RNG)), $(rand(RNG)), 1000)
+    g["SIR"] = @benchmarkable SIR(du, $([7900000.0, 10.0, 0.0]), $([0.5 / 7900000.0, 0.33]), 0.0) setup = (du = zeros(3))
+end
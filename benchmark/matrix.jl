@@ -0,0 +1,33 @@
+# The sizes are matrix orders, 500 is the typical production size
+for n in (4, 16, 64, 256, 500)
+    # diagonally dominant, so the unpivoted LU stays well defined
+    mat = rand(RNG, n, n) + n * I
+
+    group!("matrix", "lu_decompose", Float64)[string(n)] =
+        @benchmarkable lu_decompose($mat)
+    group!("matrix", "determinant", Float64)[string(n)] =
+        @benchmarkable determinant($mat)
+    group!("matrix", "lu_decompose!", Float64)[string(n)] =
+        @benchmarkable lu_decompose!($(LUWorkspace(mat)), $mat)
+    group!("matrix", "lu_decompose!(::Workspace)", Float64)[string(n)] =
+        @benchmarkable (reset!(ws); lu_decompose!(ws, $mat)) setup = (ws = Workspace())
+    group!("matrix", "determinant!", Float64)[string(n)] =
+        @benchmarkable determinant!($(LUWorkspace(mat)), $mat)
+end
+
+group!("matrix", "rotation_matrix", Float64)["1"] =
+    @benchmarkable rotation_matrix($(rand(RNG) * 2π))
+
+for N in (2, 3, 4)
+    mat = @SMatrix rand(RNG, N, N)
+    group!("matrix", "determinant(::SMatrix)", Float64)[string(N)] =
+        @benchmarkable determinant($mat)
+    group!("matrix", "lu_decompose(::SMatrix)", Float64)[string(N)] =
+        @benchmarkable lu_decompose($mat)
+end
+
+for n in SIZES
+    points = [SVector(rand(RNG), rand(RNG)) for _ in 1:n]
+    group!("matrix", "rotate_points!", Float64)[string(n)] =
+        @benchmarkable rotate_points!($(similar(points)), $(rotation_matrix(rand(RNG) * 2π)), $points)
+end
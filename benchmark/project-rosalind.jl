@@ -0,0 +1,35 @@
+for n in SIZES
+    dna = String(rand(RNG, ['A', 'C', 'G', 'T'], n))
+
+    group!("project-rosalind", "count_nucleotides", String)[string(n)] =
+        @benchmarkable count_nucleotides($dna)
+    group!("project-rosalind", "dna2rna", String)[string(n)] =
+        @benchmarkable dna2rna($dna)
+    group!("project-rosalind", "reverse_complement", String)[string(n)] =
+        @benchmarkable reverse_complement($dna)
+end
+
+for n in SIZES
+    dna = PackedDNA(String(rand(RNG, ['A', 'C', 'G', 'T'], n)))
+
+    group!("project-rosalind", "count_nucleotides", PackedDNA)[string(n)] =
+        @benchmarkable count_nucleotides($dna)
+    group!("project-rosalind", "reverse_complement", PackedDNA)[string(n)] =
+        @benchmarkable reverse_complement($dna)
+    group!("project-rosalind", "PackedDNA", String)[string(n)] =
+        @benchmarkable PackedDNA($(String(dna)))
+end
+
+# A FASTQ file of 100 bp reads, read through FastxReader
+let n = min(MAX_SIZE, 10^7), path = tempname()
+    open(path, "w") do io
+        for i in 1:cld(n, 100)
+            println(io, "@read", i, "\n", String(rand(RNG, ['A', 'C', 'G', 'T'], 100)), "\n+\n", "I"^100)
+        end
+    end
+    reader = FastxReader(path)
+    group!("project-rosalind", "count_nucleotides", FastxReader)[string(n)] =
+        @benchmarkable count_nucleotides($reader)
+    group!("project-rosalind", "reverse_complement", FastxReader)[string(n)] =
+        @benchmarkable reverse_complement($reader)
+end
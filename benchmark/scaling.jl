@@ -0,0 +1,84 @@
+# Strong and weak scaling of the distributed functions: each workload is timed
+# on 1, 2, 4, ... local workers, with the same total size (strong scaling, the
+# speedup is ideally the number of workers) and with the same size per worker
+# (weak scaling, the time is ideally constant). The inputs are generated on
+# the workers, so the times include no transfer from this process.
+#
+# Usage, from the root of the repository:
+#
+#     julia --project=benchmark benchmark/scaling.jl [options]
+#
+# Options:
+#  - `--workers=n`: largest number of workers (default: the number of CPU threads)
+#  - `--threads=n`: threads of each worker (default: 1)
+#  - `--scale=x`: multiplies the sizes of the workloads (default: 1)
+
+using Distributed
+using TheAlgorithms
+
+const PROJECT = dirname(@__DIR__)
+
+function parse_arguments(args)
+    max_workers = Sys.CPU_THREADS
+    threads = 1
+    scale = 1.0
+    for arg in args
+        if startswith(arg, "--workers=")
+            max_workers = parse(Int, arg[length("--workers=")+1:end])
+        elseif startswith(arg, "--threads=")
+            threads = parse(Int, arg[length("--threads=")+1:end])
+        elseif startswith(arg, "--scale=")
+            scale = parse(Float64, arg[length("--scale=")+1:end])
+        else
+            error("Unknown option: $arg")
+        end
+    end
+    return max_workers, threads, scale
+end
+
+# name => (size, function of the size running the workload on workers())
+function workloads(scale)
+    scaled(n) = round(Int, scale * n)
+    return [
+        "distributed_sort" => (scaled(10^7), n -> distributed_sort(ShardedVector(r -> rand(length(r)), n))),
+        "distributed_prime_count" => (scaled(10^9), n -> distributed_prime_count(n)),
+        "distributed_fit" => (scaled(10^8), n -> distributed_fit(Moments{Float64}(), r -> randn(length(r)), n)),
+        "distributed_knapsack" => (scaled(10^4), n -> distributed_knapsack((c, [3, 5, 7, 11], [4, 7, 9, 15]) for c in 1:n)),
+    ]
+end
+
+# Minimum time of a few runs of f(n), after one to compile it
+function time_workload(f, n; samples = 3)
+    f(n)
+    return minimum(@elapsed(f(n)) for _ in 1:samples)
+end
+
+function main(args)
+    max_workers, threads, scale = parse_arguments(args)
+    counts = [k for k in (2 .^ (0:20)) if k <= max_workers]
+    strong = Dict{String,Vector{Float64}}()
+    weak = Dict{String,Vector{Float64}}()
+    for k in counts
+        addprocs(k - (nprocs() - 1); exeflags = "--project=$PROJECT --threads=$threads")
+        @everywhere using TheAlgorithms
+        for (name, (n, f)) in workloads(scale)
+            push!(get!(strong, name, Float64[]), time_workload(f, n))
+            push!(get!(weak, name, Float64[]), time_workload(f, n * k))
+        end
+    end
+
+    for (name, (n, _)) in workloads(scale)
+        println(name, ", size $n (strong) and $n per worker (weak)")
+        println(rpad("workers", 10), rpad("strong (s)", 14), rpad("speedup", 10), rpad("efficiency", 12), rpad("weak (s)", 14), "efficiency")
+        t_strong, t_weak = strong[name], weak[name]
+        for (i, k) in enumerate(counts)
+            speedup = t_strong[1] / t_strong[i]
+            println(rpad(k, 10), rpad(round(t_strong[i]; digits = 3), 14), rpad(round(speedup; digits = 2), 10),
+                rpad(round(speedup / k; digits = 2), 12), rpad(round(t_weak[i]; digits = 3), 14), round(t_weak[1] / t_weak[i]; digits = 2))
+        end
+        println()
+    end
+    return 0
+end
+
+exit(main(ARGS))
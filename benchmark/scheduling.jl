@@ -0,0 +1,20 @@
+for n in SIZES
+    process_id = collect(1:n)
+    burst_time = rand(RNG, 1:100, n)
+
+    group!("scheduling", "fcfs", Int64)[string(n)] =
+        @benchmarkable fcfs($n, $process_id, $burst_time)
+end
+
+for n in SIZES
+    arrival = sort!(rand(RNG, 0:10n, n))
+    burst = rand(RNG, 1:100, n)
+    priority = rand(RNG, 1:10, n)
+    scheduler = Scheduler()
+
+    for (name, policy) in (("fcfs", FCFS()), ("sjf", SJF()), ("srtf", SRTF()),
+            ("round_robin", RoundRobin(10)), ("priority", PriorityScheduling(aging = 100)))
+        group!("scheduling", "simulate!_" * name, Int64)[string(n)] =
+            @benchmarkable simulate!($scheduler, $policy, $arrival, $burst, $priority)
+    end
+end
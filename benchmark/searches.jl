@@ -0,0 +1,48 @@
+for T in (Int64, Float64), n in SIZES
+    # evenly spaced integer keys, the best case of interpolation_search
+    sorted = T == Int64 ? collect(3:3:3n) : sort!(rand(RNG, T, n))
+    query = sorted[rand(RNG, 1:n)]
+
+    group!("searches", "binary_search", T)[string(n)] =
+        @benchmarkable binary_search($sorted, $query)
+    group!("searches", "exponential_search", T)[string(n)] =
+        @benchmarkable exponential_search($sorted, $query)
+    group!("searches", "linear_search", T)[string(n)] =
+        @benchmarkable linear_search($sorted, $query)
+
+    # interpolation_search and jump_search take their bounds in the element type
+    T == Int64 || continue
+    group!("searches", "interpolation_search", T)[string(n)] =
+        @benchmarkable interpolation_search($sorted, 1, $n, $query)
+    group!("searches", "jump_search", T)[string(n)] =
+        @benchmarkable jump_search($sorted, $query, $(isqrt(n)))
+end
+
+# Many queries against the same keys: per call binary_search vs SortedIndex
+for T in (Int64, Float64), n in SIZES
+    sorted = T == Int64 ? collect(3:3:3n) : sort!(rand(RNG, T, n))
+    queries = sorted[rand(RNG, 1:n, 10^4)]
+    idx = SortedIndex(sorted)
+    out = zeros(Int, length(queries))
+
+    group!("searches", "binary_search(check_sorted=false)", T)[string(n)] =
+        @benchmarkable foreach(q -> binary_search($sorted, q; check_sorted = false), $queries)
+    group!("searches", "searchsortedfirst(::SortedIndex)", T)[string(n)] =
+        @benchmarkable foreach(q -> searchsortedfirst($idx, q), $queries)
+    group!("searches", "searchsorted_batch!", T)[string(n)] =
+        @benchmarkable searchsorted_batch!($out, $idx, $queries)
+end
+
+# adaptive_search on keys favouring each of its strategies
+let n = min(MAX_SIZE, 10^6)
+    inputs = Dict(
+        "uniform" => collect(3.0:3.0:3n),
+        "skewed" => cumsum(rand(RNG, n) .^ 8),
+    )
+    for (name, keys) in inputs
+        idx = AdaptiveIndex(keys)
+        queries = keys[rand(RNG, 1:n, 10^4)]
+        group!("searches", "adaptive_search", name)[string(n)] =
+            @benchmarkable foreach(q -> adaptive_search($idx, q), $queries)
+    end
+end
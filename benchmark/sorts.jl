@@ -0,0 +1,43 @@
+for (name, f) in (
+    ("BubbleSort!", BubbleSort!),
+    ("InsertionSort!", InsertionSort!),
+    ("SelectionSort!", SelectionSort!),
+)
+    for T in ELTYPES, n in QUADRATIC_SIZES
+        x = rand(RNG, T, n)
+        group!("sorts", name, T)[string(n)] =
+            @benchmarkable $f(y) setup = (y = copy($x)) evals = 1
+    end
+end
+
+for (name, f) in (
+    ("QuickSort!", QuickSort!),
+    ("MergeSort!", MergeSort!),
+    ("RadixSort!", RadixSort!),
+)
+    for T in ELTYPES, n in SIZES
+        x = rand(RNG, T, n)
+        group!("sorts", name, T)[string(n)] =
+            @benchmarkable $f(y) setup = (y = copy($x)) evals = 1
+    end
+end
+
+# MergeSort! with a buffer that is reused across samples
+for T in ELTYPES, n in SIZES
+    x = rand(RNG, T, n)
+    buffer = Vector{T}(undef, cld(n, 2))
+    group!("sorts", "MergeSort!(buffer)", T)[string(n)] =
+        @benchmarkable MergeSort!(y, $buffer) setup = (y = copy($x)) evals = 1
+end
+
+# Scaling curve of ParallelSort!: start julia with `-t 32` (or `-t auto`) to
+# get every task count up to the number of threads
+const TASK_COUNTS = filter(<=(Threads.nthreads()), [1, 2, 4, 8, 16, 32, 64])
+for T in (Int64, Float64), n in filter(>=(10^5), SIZES)
+    x = rand(RNG, T, n)
+    buffer = similar(x)
+    for ntasks in TASK_COUNTS
+        group!("sorts", "ParallelSort!", T, n)["$ntasks tasks"] =
+            @benchmarkable ParallelSort!(y, $buffer; ntasks = $ntasks) setup = (y = copy($x)) evals = 1
+    end
+end
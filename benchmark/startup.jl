@@ -0,0 +1,81 @@
+# Measures the load time of the package and the time to the first call of some
+# of its functions, each in a fresh Julia process, as a short-lived worker
+# would see them. Precompilation happens before the first sample.
+#
+# Usage, from the root of the repository:
+#
+#     julia benchmark/startup.jl [options]
+#
+# Options:
+#  - `--samples=n`: processes started per measurement (default: 5)
+#  - `--max=seconds`: exit with status 1 when the median load time plus time
+#    to first call exceeds this (default: no limit)
+
+const PROJECT = dirname(@__DIR__)
+
+# Calls timed after `using TheAlgorithms`, each in its own process
+const FIRST_CALLS = [
+    "sort" => "QuickSort!(rand(1000))",
+    "search" => "binary_search(collect(1:1000), 500)",
+    "median" => "median(rand(1000))",
+    "ode" => "solve_sir([7900000.0, 10.0, 0.0], (0.0, 140.0), [0.5 / 7900000.0, 0.33])",
+    "knapsack" => "knapsack!(KnapsackSolver(), 20, [1, 3, 11], [2, 5, 30])",
+    "dna" => "reverse_complement(PackedDNA(\"AAAACCCGGT\"))",
+    "palindrome" => "is_palindrome(\"racecar\")",
+]
+
+function parse_arguments(args)
+    samples = 5
+    max_time = Inf
+    for arg in args
+        if startswith(arg, "--samples=")
+            samples = parse(Int, arg[length("--samples=")+1:end])
+        elseif startswith(arg, "--max=")
+            max_time = parse(Float64, arg[length("--max=")+1:end])
+        else
+            error("Unknown option: $arg")
+        end
+    end
+    return samples, max_time
+end
+
+"""
+    startup_times(call)
+
+Load time of the package and time of `call` right after, in seconds, in a new
+Julia process.
+"""
+function startup_times(call)
+    script = """
+        t = time_ns()
+        using TheAlgorithms
+        load = (time_ns() - t) / 1e9
+        t = time_ns()
+        $call
+        print(load, " ", (time_ns() - t) / 1e9)
+        """
+    output = read(`$(Base.julia_cmd()) --startup-file=no --project=$PROJECT -e $script`, String)
+    load, first_call = parse.(Float64, split(output))
+    return load, first_call
+end
+
+median(x) = (y = sort(x); n = length(y); (y[(n + 1) ÷ 2] + y[n ÷ 2 + 1]) / 2)
+
+function main(args)
+    samples, max_time = parse_arguments(args)
+
+    # precompiles the package if needed, outside the measurements
+    run(`$(Base.julia_cmd()) --startup-file=no --project=$PROJECT -e "using TheAlgorithms"`)
+
+    worst = 0.0
+    println(rpad("call", 12), rpad("load (s)", 12), "first call (s)")
+    for (name, call) in FIRST_CALLS
+        times = [startup_times(call) for _ in 1:samples]
+        load, first_call = median(first.(times)), median(last.(times))
+        worst = max(worst, load + first_call)
+        println(rpad(name, 12), rpad(round(load; digits = 3), 12), round(first_call; digits = 3))
+    end
+    return worst <= max_time ? 0 : 1
+end
+
+exit(main(ARGS))
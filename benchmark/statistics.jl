@@ -0,0 +1,55 @@
+for T in (Float64, Float32), n in SIZES
+    x = rand(RNG, T, n)
+    y = 3x .+ rand(RNG, T, n)
+
+    group!("statistics", "variance", T)[string(n)] =
+        @benchmarkable variance($x)
+    group!("statistics", "pearson_correlation", T)[string(n)] =
+        @benchmarkable pearson_correlation($x, $y)
+    group!("statistics", "OLSbeta", T)[string(n)] =
+        @benchmarkable OLSbeta($y, $x)
+end
+
+for T in (Float64, Float32), n in SIZES
+    x = rand(RNG, T, n)
+    y = 3x .+ rand(RNG, T, n)
+
+    group!("statistics", "fit!(::Moments)", T)[string(n)] =
+        @benchmarkable fit!(Moments{$T}(), $x)
+    group!("statistics", "fit!(::CoMoments)", T)[string(n)] =
+        @benchmarkable fit!(CoMoments{$T}(), $x, $y)
+    Threads.nthreads() > 1 || continue
+    group!("statistics", "fit!(::CoMoments, ntasks=nthreads)", T)[string(n)] =
+        @benchmarkable fit!(CoMoments{$T}(), $x, $y, ntasks = Threads.nthreads())
+end
+
+# Regressions with 10 regressors, from the rows to the coefficients
+for n in SIZES
+    X = [ones(n) randn(RNG, n, 9)]
+    y = X * randn(RNG, 10) + randn(RNG, n)
+    w = rand(RNG, n)
+    solver = fit!(OLSSolver(10), X, y)
+
+    group!("statistics", "fit!(::OLSSolver)", Float64)[string(n)] =
+        @benchmarkable fit!(s, $X, $y) setup = (s = OLSSolver(10))
+    group!("statistics", "fit!(::OLSSolver, weights)", Float64)[string(n)] =
+        @benchmarkable fit!(s, $X, $y, $w) setup = (s = OLSSolver(10))
+    group!("statistics", "OLSbeta(matrix)", Float64)[string(n)] =
+        @benchmarkable OLSbeta($y, $X)
+    n == first(SIZES) || continue
+    group!("statistics", "coef!(::OLSSolver)", Float64)["10"] =
+        @benchmarkable coef!($(zeros(10)), $solver)
+end
+
+# Streaming sketches, over values drawn with a skewed distribution
+for n in SIZES
+    x = randn(RNG, n)
+    keys_stream = [rand(RNG) < 0.5 ? rand(RNG, 1:100) : rand(RNG, 1:n) for _ in 1:n]
+
+    group!("statistics", "fit!(::P2Quantile)", Float64)[string(n)] =
+        @benchmarkable fit!(P2Quantile(0.99), $x)
+    group!("statistics", "fit!(::CountMinSketch)", Int64)[string(n)] =
+        @benchmarkable fit!(CountMinSketch(), $keys_stream)
+    group!("statistics", "fit!(::HeavyHitters)", Int64)[string(n)] =
+        @benchmarkable fit!(HeavyHitters{Int}(100), $keys_stream)
+end
@@ -0,0 +1,19 @@
+for n in SIZES
+    half = String(rand(RNG, 'a':'z', n ÷ 2))
+    palindrome = half * reverse(half)
+
+    group!("strings", "is_palindrome", String)[string(n)] =
+        @benchmarkable is_palindrome($palindrome)
+    group!("strings", "is_palindrome(ignore_case, ignore_punctuation)", String)[string(n)] =
+        @benchmarkable is_palindrome($palindrome; ignore_case = true, ignore_punctuation = true)
+    group!("strings", "longest_palindrome", String)[string(n)] =
+        @benchmarkable longest_palindrome($(String(rand(RNG, 'a':'c', n))))
+end
+
+# The sizes are numbers of short tokens
+for n in SIZES
+    tokens = [String(rand(RNG, 'a':'b', rand(RNG, 1:8))) for _ in 1:n]
+
+    group!("strings", "map_predicate(is_palindrome, tokens)", String)[string(n)] =
+        @benchmarkable map_predicate(is_palindrome, $tokens)
+end
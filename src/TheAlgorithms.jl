@@ -1,34 +1,72 @@
 module TheAlgorithms
 
 # Usings/Imports (keep sorted)
-using DataFrames
-using DifferentialEquations
-using GLM
+using Distributed
 using LinearAlgebra
-using Plots
+using Mmap
+using PrecompileTools
 using Random
+using StaticArrays
 
 
 ## Exports
 # Please keep the folders/functions sorted
 
+# Exports: instrumentation
+export enable_instrumentation
+export instrumentation_counts
+export instrumentation_sections
+export report
+export reset_instrumentation!
+
+# Exports: workspace
+export acquire!
+export reset!
+export task_workspace
+export Workspace
+
+# Exports: distributed
+export distributed_fit
+export distributed_knapsack
+export distributed_prime_count
+export distributed_primes
+export distributed_sort
+export map_shards
+export mapreduce_shards
+export ShardedVector
+
 # Exports: data_structures
 export AbstractBinaryTree
 export AbstractBinaryTree_arr
 export BinaryTree
 export ch
+export compact!
+export ConcurrentDisjointSet
 export depth
 export DisjointSet
 export find
 export height
+export inorder
 export insert!
 export isleaf
+export kth
 export left
+export levelorder
 export merge!
+export num_sets
+export OrderedIndex
+export postorder
+export preorder
 export right
+export scan
+export set_size
 
 # Exports: knapsack
 export complete_pack!
+export knapsack!
+export KnapsackSolver
+export subset_sums
+export subset_sums!
 export zero_one_pack!
 
 # Exports: math
@@ -36,105 +74,223 @@ export abs_max
 export abs_min
 export abs_val
 export area_circle
+export area_circle!
 export area_ellipse
+export area_ellipse!
 export area_heron_triangle
+export area_heron_triangle!
 export area_parallelogram
+export area_parallelogram!
+export area_polygon
+export area_polygon!
 export area_rectangle
+export area_rectangle!
 export area_rhombus
+export area_rhombus!
 export area_square
+export area_square!
 export area_trapezium
+export area_trapezium!
 export area_triangle
+export area_triangle!
 export ceil_val
 export collatz_sequence
+export collatz_sequence!
+export collatz_stopping_times
+export collatz_stopping_times!
+export CollatzSequence
+export DormandPrince
 export euler_method
 export floor_val
+export gauss_kronrod
+export gauss_kronrod!
+export factorial_fast
 export factorial_iterative
 export factorial_recursive
+export ForwardEuler
 export is_armstrong
 export line_length
+export map_predicate
 export mean
 export median
+export median!
 export mode
+export mode!
+export ODECache
+export ode_cache
 export prime_check
 export prime_factors
+export prime_factors!
+export PrimeTable
 export perfect_cube
 export perfect_number
+export perfect_numbers
 export perfect_square
+export quantile
+export quantile!
+export romberg
+export RungeKutta4
+export simpson
+export simpson!
 export SIR # TODO: make the name lowercase if possible
+export solve_ensemble!
+export solve_ode!
+export solve_sir
 export sum_ap
 export sum_gp
 export surfarea_cube
+export surfarea_cube!
 export surfarea_sphere
+export surfarea_sphere!
 export trapazoidal_area
+export trapezoid
+export trapezoid!
 
 # Exports: matrix
 export determinant
+export determinant!
 export lu_decompose
+export lu_decompose!
+export LUWorkspace
+export rotate_points!
 export rotation_matrix
 
 # Exports: project-rosalind
 export count_nucleotides
 export dna2rna
+export FastxReader
+export FastxRecord
+export nucleotide_counts
+export PackedDNA
+export PackedRNA
 export reverse_complement
+export sequence
 
 # Exports: searches
+export adaptive_search
+export AdaptiveIndex
 export binary_search
 export exponential_search
 export interpolation_search
 export jump_search
 export linear_search
+export searchsorted_batch!
+export SortedIndex
 
 # Exports: sorts
-export BubbleSort!,InsertionSort!,SelectionSort!
+export BubbleSort!,InsertionSort!,MergeSort!,ParallelSort!,QuickSort!,RadixSort!,SelectionSort!
 
 # Exports: statistics
+export coef
+export coef!
+export CoMoments
+export CountMinSketch
+export covariance
+export fit!
+export HeavyHitters
+export linear_fit
+export Moments
+export nobs
 export OLSbeta # TODO: make the name lowercase if possible
+export OLSSolver
+export P2Quantile
 export pearson_correlation
+export topk
 export variance
 
 # Exports: strings
 export is_palindrome
+export longest_palindrome
 
 # Exports: scheduling
+export average_turnaround_time
+export average_waiting_time
 export fcfs
+export fcfs!
+export FCFS
+export PriorityScheduling
+export RoundRobin
+export ScheduleResult
+export Scheduler
+export simulate!
+export SJF
+export SRTF
 
 # Exports: conversions
+export AtomicMassUnit
+export Carat
+export Celsius
 export celsius_to_fahrenheit
+export celsius_to_fahrenheit!
 export celsius_to_kelvin
+export celsius_to_kelvin!
+export conversion
+export convert_unit
+export convert_unit!
+export Fahrenheit
 export fahrenheit_to_celsius
+export fahrenheit_to_celsius!
 export fahrenheit_to_kelvin
+export fahrenheit_to_kelvin!
+export Gram
+export Kelvin
 export kelvin_to_celsius
+export kelvin_to_celsius!
 export kelvin_to_fahrenheit
+export kelvin_to_fahrenheit!
+export Kilogram
+export LongTon
+export MetricTon
+export Milligram
+export Ounce
+export Pound
+export ShortTon
+export UnitConversion
 export weight_conversion
+export weight_conversion!
 
 ## Includes
 # Please keep the folders/files sorted (by dependencies then alphabetical order)
 
+# Includes: instrumentation, used by the others
+include("instrumentation.jl")
+
+# Includes: workspace, used by the others
+include("workspace.jl")
+
 # Includes: data_structures
 include("data_structures/binary_tree/basic_binary_tree.jl")
 include("data_structures/disjoint_set/disjoint_set.jl")
+include("data_structures/disjoint_set/concurrent_disjoint_set.jl")
+include("data_structures/ordered_index/ordered_index.jl")
 
 # Includes: knapsack
 include("knapsack/knapsack.jl")
+include("knapsack/knapsack_solver.jl")
 
 # Includes: math
 include("math/abs.jl")
 include("math/area.jl")
+include("math/batched_area.jl")
 include("math/area_under_curve.jl")
 include("math/armstrong_number.jl")
 include("math/average_mean.jl")
-include("math/ceil_floor.jl") # needed by average_median
+include("math/ceil_floor.jl")
 include("math/average_median.jl")
 include("math/average_mode.jl")
 include("math/collatz_sequence.jl")
 include("math/euler_method.jl")
 include("math/factorial.jl")
 include("math/line_length.jl")
+include("math/prime_table.jl") # used by prime_check and prime_factors
 include("math/prime_check.jl")
 include("math/prime_factors.jl")
 include("math/perfect_cube.jl")
 include("math/perfect_number.jl")
 include("math/perfect_square.jl")
+include("math/quadrature.jl")
+include("math/batched_predicates.jl")
+include("math/ode_solvers.jl") # used by sir_model
 include("math/sir_model.jl")
 include("math/sum_of_arithmetic_series.jl")
 include("math/sum_of_geometric_progression.jl")
@@ -145,12 +301,15 @@ include("matrix/determinant.jl")
 include("matrix/rotation-matrix.jl")
 
 # Includes: project-rosalind
+include("project-rosalind/packed_dna.jl") # used by the others
+include("project-rosalind/fastx_reader.jl") # used by the others
 include("project-rosalind/count_nucleotide.jl")
 include("project-rosalind/dna2rna.jl")
 include("project-rosalind/reverse_complement.jl")
 
 # Includes: scheduling
 include("scheduling/fcfs.jl")
+include("scheduling/scheduler.jl")
 
 # Includes: search
 include("searches/binary_search.jl")
@@ -158,13 +317,22 @@ include("searches/exponential_search.jl")
 include("searches/interpolation_search.jl")
 include("searches/jump_search.jl")
 include("searches/linear_search.jl")
+include("searches/sorted_index.jl") # used by adaptive_search
+include("searches/adaptive_search.jl")
 
 # Includes: sorts
 include("sorts/bubble_sort.jl")
-include("sorts/insertion_sort.jl")
+include("sorts/insertion_sort.jl") # used by merge_sort and quick_sort
+include("sorts/merge_sort.jl") # used by parallel_sort
+include("sorts/parallel_sort.jl")
+include("sorts/quick_sort.jl")
+include("sorts/radix_sort.jl")
 include("sorts/selection_sort.jl")
 
 # Includes: statistics
+include("statistics/online_statistics.jl") # used by variance
+include("statistics/frequency_sketch.jl")
+include("statistics/streaming_quantile.jl")
 include("statistics/ordinary_least_squares.jl")
 include("statistics/pearson_correlation.jl")
 include("statistics/variance.jl")
@@ -172,11 +340,19 @@ include("statistics/variance.jl")
 # Includes: strings
 include("strings/is_palindrome.jl")
 
-# Includes: scheduling
-include("scheduling/fcfs.jl")
-
 # Includes: conversions
+include("conversions/units.jl")
 include("conversions/weight_conversion.jl")
 include("conversions/temparature_conversion.jl")
 
+# Includes: distributed, uses knapsack, math, sorts and statistics
+include("distributed/sharded_vector.jl") # used by the others
+include("distributed/distributed_knapsack.jl")
+include("distributed/distributed_primes.jl")
+include("distributed/distributed_sort.jl")
+include("distributed/distributed_statistics.jl")
+
+# Precompilation of the functions above, keep last
+include("precompile.jl")
+
 end
@@ -121,3 +121,28 @@ kelvin_to_fahrenheit(300) == 80.33          # returns true
 function kelvin_to_fahrenheit(kelvin, ndigits::Int = 2)
     round(((float(kelvin) - 273.15) * 9 / 5) + 32; digits = ndigits)
 end
+
+"""
+    celsius_to_fahrenheit!(out, celsius)
+    celsius_to_kelvin!(out, celsius)
+    fahrenheit_to_celsius!(out, fahrenheit)
+    fahrenheit_to_kelvin!(out, fahrenheit)
+    kelvin_to_celsius!(out, kelvin)
+    kelvin_to_fahrenheit!(out, kelvin)
+
+Converts the temperatures of an array into `out`, which may be the same
+array, without rounding: one fused multiply-add per element, by
+`convert_unit!`, at the precision of `out`.
+
+# Example
+
+```julia
+celsius_to_kelvin!(zeros(Float32, 2), Float32[0, 20])   # returns Float32[273.15, 293.15]
+```
+"""
+celsius_to_fahrenheit!(out::AbstractArray, celsius::AbstractArray) = convert_unit!(out, celsius, Celsius(), Fahrenheit())
+celsius_to_kelvin!(out::AbstractArray, celsius::AbstractArray) = convert_unit!(out, celsius, Celsius(), Kelvin())
+fahrenheit_to_celsius!(out::AbstractArray, fahrenheit::AbstractArray) = convert_unit!(out, fahrenheit, Fahrenheit(), Celsius())
+fahrenheit_to_kelvin!(out::AbstractArray, fahrenheit::AbstractArray) = convert_unit!(out, fahrenheit, Fahrenheit(), Kelvin())
+kelvin_to_celsius!(out::AbstractArray, kelvin::AbstractArray) = convert_unit!(out, kelvin, Kelvin(), Celsius())
+kelvin_to_fahrenheit!(out::AbstractArray, kelvin::AbstractArray) = convert_unit!(out, kelvin, Kelvin(), Fahrenheit())
@@ -0,0 +1,127 @@
+"""
+    Celsius(), Fahrenheit(), Kelvin()
+    Kilogram(), Gram(), Milligram(), MetricTon(), LongTon(), ShortTon(), Pound(),
+    Ounce(), Carat(), AtomicMassUnit()
+
+Units of temperature and of mass, as singleton types: the conversion factors
+between two units are functions of their types only, and are folded into
+constants when the code converting them is compiled.
+
+See `conversion` and `convert_unit!`.
+"""
+abstract type Unit end
+abstract type TemperatureUnit <: Unit end
+abstract type MassUnit <: Unit end
+
+struct Celsius <: TemperatureUnit end
+struct Fahrenheit <: TemperatureUnit end
+struct Kelvin <: TemperatureUnit end
+
+struct Kilogram <: MassUnit end
+struct Gram <: MassUnit end
+struct Milligram <: MassUnit end
+struct MetricTon <: MassUnit end
+struct LongTon <: MassUnit end
+struct ShortTon <: MassUnit end
+struct Pound <: MassUnit end
+struct Ounce <: MassUnit end
+struct Carat <: MassUnit end
+struct AtomicMassUnit <: MassUnit end
+
+# Temperatures in kelvin, as scale * t + offset
+kelvin_scale(::Celsius) = 1.0
+kelvin_scale(::Fahrenheit) = 5 / 9
+kelvin_scale(::Kelvin) = 1.0
+kelvin_offset(::Celsius) = 273.15
+kelvin_offset(::Fahrenheit) = 273.15 - 32 * 5 / 9
+kelvin_offset(::Kelvin) = 0.0
+
+# Kilograms in a unit, and the other way around, as in the charts of weight_conversion
+per_kilogram(::Kilogram) = 1.0
+per_kilogram(::Gram) = 1.0e3
+per_kilogram(::Milligram) = 1.0e6
+per_kilogram(::MetricTon) = 10^-3
+per_kilogram(::LongTon) = 0.0009842073
+per_kilogram(::ShortTon) = 0.0011023122
+per_kilogram(::Pound) = 2.2046244202
+per_kilogram(::Ounce) = 35.273990723
+per_kilogram(::Carat) = 5000.0
+per_kilogram(::AtomicMassUnit) = 6.022136652e26
+
+kilograms(::Kilogram) = 1.0
+kilograms(::Gram) = 10^-3
+kilograms(::Milligram) = 10^-6
+kilograms(::MetricTon) = 1.0e3
+kilograms(::LongTon) = 1016.04608
+kilograms(::ShortTon) = 907.184
+kilograms(::Pound) = 0.453592
+kilograms(::Ounce) = 0.0283495
+kilograms(::Carat) = 0.0002
+kilograms(::AtomicMassUnit) = 1.660540199e-27
+
+"""
+    conversion(from, to)
+    UnitConversion(scale, offset)
+
+Conversion between two units of the same quantity, the affine map
+`x -> scale * x + offset` (linear for masses). A `UnitConversion` is called
+on a number, or applied to arrays by `convert_unit!`, and chained conversions
+compose into a single one with `∘`.
+
+# Example
+
+```julia
+c = conversion(Celsius(), Fahrenheit())
+c(100.0)                                                    # returns 212.0
+conversion(Kelvin(), Celsius()) ∘ conversion(Fahrenheit(), Kelvin())   # one affine map
+```
+"""
+struct UnitConversion{T<:Real}
+    scale::T
+    offset::T
+end
+
+@inline function conversion(from::TemperatureUnit, to::TemperatureUnit)
+    scale = kelvin_scale(from) / kelvin_scale(to)
+    return UnitConversion(scale, (kelvin_offset(from) - kelvin_offset(to)) / kelvin_scale(to))
+end
+
+@inline conversion(from::MassUnit, to::MassUnit) = UnitConversion(kilograms(from) * per_kilogram(to), 0.0)
+
+@inline (c::UnitConversion)(x::Real) = muladd(x, oftype(float(x), c.scale), oftype(float(x), c.offset))
+
+Base.:∘(b::UnitConversion, a::UnitConversion) = UnitConversion(b.scale * a.scale, muladd(a.offset, b.scale, b.offset))
+
+Base.inv(c::UnitConversion) = UnitConversion(1 / c.scale, -c.offset / c.scale)
+
+"""
+    convert_unit(x, from, to)
+    convert_unit!(out, x, from, to)
+    convert_unit!(out, x, conversion)
+
+Converts the number `x`, or the elements of the array `x` into `out` (which
+may be `x` itself), from the unit `from` to the unit `to`, or with a
+`UnitConversion`. The loop is a fused multiply-add per element, with the
+factors in the element type of `out`, so that `Float32` and `Float64` arrays
+are converted with SIMD instructions.
+
+# Example
+
+```julia
+readings = Float32[20.5, 21.0, 19.8]
+convert_unit!(similar(readings), readings, Celsius(), Kelvin())   # returns Float32[293.65, 294.15, 292.95]
+convert_unit(2, Pound(), Kilogram())                              # returns 0.907184
+```
+"""
+@inline convert_unit(x::Real, from::Unit, to::Unit) = conversion(from, to)(x)
+
+convert_unit!(out::AbstractArray, x::AbstractArray, from::Unit, to::Unit) = convert_unit!(out, x, conversion(from, to))
+
+function convert_unit!(out::AbstractArray{T}, x::AbstractArray, c::UnitConversion) where T<:AbstractFloat
+    axes(out) == axes(x) || throw(DimensionMismatch("output of axes $(axes(out)) for an input of axes $(axes(x))"))
+    scale, offset = T(c.scale), T(c.offset)
+    @inbounds @simd for i in eachindex(out, x)
+        out[i] = muladd(T(x[i]), scale, offset)
+    end
+    return out
+end
@@ -1,30 +1,48 @@
-KILOGRAM_CHART = Dict{String,Float64}(
-    "kilogram" => 1,
-    "gram" => 10^3,
-    "milligram" => 10^6,
-    "metric-ton" => 10^-3,
-    "long-ton" => 0.0009842073,
-    "short-ton" => 0.0011023122,
-    "pound" => 2.2046244202,
-    "ounce" => 35.273990723,
-    "carrat" => 5000,
-    "atomic-mass-unit" => 6.022136652e26,
+# The units of weight_conversion, by name
+const MASS_UNITS = Dict{String,MassUnit}(
+    "kilogram" => Kilogram(),
+    "gram" => Gram(),
+    "milligram" => Milligram(),
+    "metric-ton" => MetricTon(),
+    "long-ton" => LongTon(),
+    "short-ton" => ShortTon(),
+    "pound" => Pound(),
+    "ounce" => Ounce(),
+    "carrat" => Carat(),
+    "atomic-mass-unit" => AtomicMassUnit(),
 )
 
-WEIGHT_TYPE_CHART = Dict{String,Float64}(
-    "kilogram" => 1,
-    "gram" => 10^-3,
-    "milligram" => 10^-6,
-    "metric-ton" => 10^3,
-    "long-ton" => 1016.04608,
-    "short-ton" => 907.184,
-    "pound" => 0.453592,
-    "ounce" => 0.0283495,
-    "carrat" => 0.0002,
-    "atomic-mass-unit" => 1.660540199e-27,
-)
+const KILOGRAM_CHART = Dict{String,Float64}(name => per_kilogram(unit) for (name, unit) in MASS_UNITS)
+
+const WEIGHT_TYPE_CHART = Dict{String,Float64}(name => kilograms(unit) for (name, unit) in MASS_UNITS)
+
+"""
+    weight_conversion(from_type, to_type, value)
+    weight_conversion!(out, from_type, to_type, values)
 
+Converts the mass `value`, or the elements of the array `values` into `out`,
+from the unit named `from_type` to the one named `to_type`, among the keys of
+`KILOGRAM_CHART`. The units are looked up once for an array, which is then
+converted by `convert_unit!`.
+
+# Example
+
+```julia
+weight_conversion("kilogram", "pound", 4)   # returns 8.8184976808
+weight_conversion!(zeros(3), "gram", "kilogram", [1.0, 10.0, 100.0])   # ≈ [0.001, 0.01, 0.1]
+```
+"""
 function weight_conversion(from_type, to_type, value)
+    check_weight_types(from_type, to_type)
+    return value * KILOGRAM_CHART[to_type] * WEIGHT_TYPE_CHART[from_type]
+end
+
+function weight_conversion!(out::AbstractArray, from_type, to_type, values::AbstractArray)
+    check_weight_types(from_type, to_type)
+    return convert_unit!(out, values, conversion(MASS_UNITS[from_type], MASS_UNITS[to_type]))
+end
+
+function check_weight_types(from_type, to_type)
     if !haskey(KILOGRAM_CHART, to_type) || !haskey(WEIGHT_TYPE_CHART, from_type)
         throw(
             error(
@@ -33,5 +51,4 @@ function weight_conversion(from_type, to_type, value)
             ),
         )
     end
-    return value * KILOGRAM_CHART[to_type] * WEIGHT_TYPE_CHART[from_type]
 end
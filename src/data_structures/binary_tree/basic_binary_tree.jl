@@ -3,29 +3,85 @@ abstract type AbstractBinaryTree end
 array-based binary tree
 """
 abstract type AbstractBinaryTree_arr<:AbstractBinaryTree end
+
+"""
+    BinaryTree{T}(size, rootval)
+    BinaryTree(values)
+
+Binary tree of values of type `T`, stored as a structure of arrays: node `i` has
+the value `val[i]`, the parent `par[i]` and the children `lch[i]` and `rch[i]`
+(0 if there is none), as `Int32` indices. The arrays grow as nodes are inserted,
+`size` is only the number of nodes to make room for.
+
+`BinaryTree(values)` builds a complete tree of `length(values)` nodes in breadth
+first order, node `k` having the children `2k` and `2k + 1`, and gives them the
+values in in-order: sorted values make a balanced binary search tree.
+`compact!(tree)` lays the nodes out again in van Emde Boas order.
+
+`preorder`, `inorder`, `postorder` and `levelorder` iterate over the nodes
+without recursion nor allocation, following the parent links.
+"""
 mutable struct BinaryTree{T}<:AbstractBinaryTree_arr where T
     n::Int
     root::Int
-    par::Vector{Int}
-    lch::Vector{Int}
-    rch::Vector{Int}
+    par::Vector{Int32}
+    lch::Vector{Int32}
+    rch::Vector{Int32}
     val::Vector{T}
 end
 function BinaryTree{T}(size::Int,rootval::T)where T
-    x=BinaryTree(1,1,zeros(T,size),zeros(T,size),zeros(T,size),Vector{T}(undef,size))
-    x.val[1]=rootval
+    x=BinaryTree(1,1,Int32[0],Int32[0],Int32[0],T[rootval])
+    for v in (x.par, x.lch, x.rch, x.val)
+        sizehint!(v, size)
+    end
     return x
 end
 
+function BinaryTree(values::AbstractVector{T}) where T
+    n = length(values)
+    n == 0 && throw(ArgumentError("a BinaryTree needs a root value"))
+    par = Int32[k ÷ 2 for k in 1:n]
+    lch = Int32[2k <= n ? 2k : 0 for k in 1:n]
+    rch = Int32[2k + 1 <= n ? 2k + 1 : 0 for k in 1:n]
+    val = Vector{T}(undef, n)
+    # in-order walk of the heap shaped tree, from its leftmost node
+    k = 1
+    while 2k <= n
+        k *= 2
+    end
+    for v in values
+        val[k] = v
+        if 2k + 1 <= n
+            k = 2k + 1
+            while 2k <= n
+                k *= 2
+            end
+        else
+            while k > 1 && isodd(k)
+                k ÷= 2
+            end
+            k ÷= 2
+        end
+    end
+    return BinaryTree{T}(n, 1, par, lch, rch, val)
+end
+
+"""
+Adds a node of value `value` as the right (`place` true) or left child of
+`from`, and returns its index.
+"""
 function Base.insert!(tree::BinaryTree,from::Int,value,place::Bool)
     tree.n+=1
-    tree.par[tree.n]=from
+    push!(tree.par, from)
+    push!(tree.lch, 0)
+    push!(tree.rch, 0)
+    push!(tree.val, value)
     if place
         tree.rch[from]=tree.n
     else
         tree.lch[from]=tree.n
     end
-    tree.val[tree.n]=value
+    return tree.n
 end
 
 function Base.insert!(tree::BinaryTree,from::Int,value)
@@ -45,15 +101,18 @@ function isleaf(tree::Tree,from::Int)::Bool where Tree<:AbstractBinaryTree_arr
 end
 
 function ch(tree::Tree,from::Int,select::Bool)where Tree<:AbstractBinaryTree_arr
-    if select return tree.rch[from] 
-    else return tree.lch[from] 
+    if select return Int(tree.rch[from])
+    else return Int(tree.lch[from])
     end
 end
 
 function height(tree::Tree,from::Int=tree.root)where Tree<:AbstractBinaryTree_arr
     count=0
-    if tree.lch[from]!=0 count=height(tree,tree.lch[from])+1 end
-    if tree.rch[from]!=0 count=max(height(tree,tree.rch[from])+1,count) end
+    x, d = from, 0
+    while x != 0
+        count = max(count, d)
+        x, d = next_preorder(tree, x, d, typemax(Int), from)
+    end
     return count
 end
 
@@ -61,23 +120,196 @@ function depth(tree::Tree,from::Int)where Tree<:AbstractBinaryTree_arr
     count=0
     while from!=tree.root
         count+=1
-        from=tree.par[from]
+        from=Int(tree.par[from])
     end
     return count
 end
 
 function left(tree::Tree,from::Int=tree.root)where Tree<:AbstractBinaryTree_arr
-    if tree.lch[from]==0
-        return from
-    else
-        return left(tree,tree.lch[from])
+    while tree.lch[from]!=0
+        from=Int(tree.lch[from])
     end
+    return from
 end
 
 function right(tree::Tree,from::Int=tree.root)where Tree<:AbstractBinaryTree_arr
-    if tree.rch[from]==0
-        return from
-    else
-        return right(tree,tree.rch[from])
+    while tree.rch[from]!=0
+        from=Int(tree.rch[from])
+    end
+    return from
+end
+
+# Node after x, at depth d, in the preorder of the subtree of stop, without the
+# nodes deeper than limit, and its depth; (0, 0) after the last one
+@inline function next_preorder(tree::AbstractBinaryTree_arr, x::Int, d::Int, limit::Int=typemax(Int), stop::Int=tree.root)
+    if d < limit
+        l = Int(tree.lch[x])
+        l != 0 && return l, d + 1
+        r = Int(tree.rch[x])
+        r != 0 && return r, d + 1
+    end
+    while x != stop
+        p = Int(tree.par[x])
+        r = Int(tree.rch[p])
+        r != 0 && r != x && return r, d
+        x = p
+        d -= 1
+    end
+    return 0, 0
+end
+
+@inline function next_inorder(tree::AbstractBinaryTree_arr, x::Int)
+    tree.rch[x] != 0 && return left(tree, Int(tree.rch[x]))
+    while x != tree.root
+        p = Int(tree.par[x])
+        tree.lch[p] == x && return p
+        x = p
+    end
+    return 0
+end
+
+# First node of the subtree of x in postorder, its leftmost deepest leaf
+@inline function first_postorder(tree::AbstractBinaryTree_arr, x::Int)
+    while true
+        if tree.lch[x] != 0
+            x = Int(tree.lch[x])
+        elseif tree.rch[x] != 0
+            x = Int(tree.rch[x])
+        else
+            return x
+        end
+    end
+end
+
+@inline function next_postorder(tree::AbstractBinaryTree_arr, x::Int)
+    x == tree.root && return 0
+    p = Int(tree.par[x])
+    r = Int(tree.rch[p])
+    return tree.lch[p] == x && r != 0 ? first_postorder(tree, r) : p
+end
+
+struct PreOrder{Tree<:AbstractBinaryTree_arr}
+    tree::Tree
+end
+struct InOrder{Tree<:AbstractBinaryTree_arr}
+    tree::Tree
+end
+struct PostOrder{Tree<:AbstractBinaryTree_arr}
+    tree::Tree
+end
+struct LevelOrder{Tree<:AbstractBinaryTree_arr}
+    tree::Tree
+end
+
+"""
+    preorder(tree)
+    inorder(tree)
+    postorder(tree)
+    levelorder(tree)
+
+Iterators over the node indices of `tree` in preorder (node, left subtree,
+right subtree), in-order (left subtree, node, right subtree), postorder (left
+subtree, right subtree, node) or level order (by depth, then from left to right).
+
+They keep the current node only and move along the parent links, so they
+allocate nothing and cannot overflow the stack. `levelorder` walks the tree
+once per level, in a time proportional to the number of nodes times the height.
+
+# Example
+
+```julia
+tree = BinaryTree([1, 2, 3, 4, 5])
+[tree.val[i] for i in inorder(tree)]   # returns [1, 2, 3, 4, 5]
+collect(levelorder(tree))              # returns [1, 2, 3, 4, 5], the breadth first layout
+```
+"""
+preorder(tree::AbstractBinaryTree_arr) = PreOrder(tree)
+inorder(tree::AbstractBinaryTree_arr) = InOrder(tree)
+postorder(tree::AbstractBinaryTree_arr) = PostOrder(tree)
+levelorder(tree::AbstractBinaryTree_arr) = LevelOrder(tree)
+
+const Traversal = Union{PreOrder,InOrder,PostOrder,LevelOrder}
+Base.length(it::Traversal) = it.tree.n
+Base.eltype(::Type{<:Traversal}) = Int
+
+function Base.iterate(it::PreOrder, state = (it.tree.root, 0))
+    x, d = state
+    (x == 0 || it.tree.n == 0) && return nothing
+    return x, next_preorder(it.tree, x, d)
+end
+
+function Base.iterate(it::InOrder, x = it.tree.n == 0 ? 0 : left(it.tree))
+    x == 0 && return nothing
+    return x, next_inorder(it.tree, x)
+end
+
+function Base.iterate(it::PostOrder, x = it.tree.n == 0 ? 0 : first_postorder(it.tree, it.tree.root))
+    x == 0 && return nothing
+    return x, next_postorder(it.tree, x)
+end
+
+# The state is the node, its depth, the level being listed and whether it has deeper nodes
+function Base.iterate(it::LevelOrder, state = (it.tree.n == 0 ? 0 : it.tree.root, 0, 0, false))
+    tree = it.tree
+    x, d, level, deeper = state
+    tree.n == 0 && return nothing
+    while true
+        if x == 0
+            deeper || return nothing
+            x, d, level, deeper = tree.root, 0, level + 1, false
+        end
+        if d == level
+            deeper |= !isleaf(tree, x)
+            return x, (next_preorder(tree, x, d, level)..., level, deeper)
+        end
+        x, d = next_preorder(tree, x, d, level)
+    end
+end
+
+"""
+    compact!(tree::BinaryTree)
+
+Renumbers the nodes of `tree` in van Emde Boas order, the root becoming node 1:
+the top half of the levels is laid out first, recursively in the same order,
+then each subtree hanging below it. A path from the root then crosses about
+`log(n) / log(B)` blocks of `B` nodes, whatever the block (cache line, page)
+size, instead of one block per level. Returns `tree`.
+
+# Reference
+- Prokop, Cache-oblivious algorithms (1999)
+"""
+function compact!(tree::BinaryTree)
+    tree.n == 0 && return tree
+    order = Int[]
+    sizehint!(order, tree.n)
+    veb_order!(order, tree, tree.root, height(tree) + 1)
+    newindex = zeros(Int32, tree.n)
+    for (i, x) in enumerate(order)
+        newindex[x] = i
+    end
+    renumber(x) = x == 0 ? Int32(0) : newindex[x]
+    tree.par = [renumber(tree.par[x]) for x in order]
+    tree.lch = [renumber(tree.lch[x]) for x in order]
+    tree.rch = [renumber(tree.rch[x]) for x in order]
+    tree.val = tree.val[order]
+    tree.root = 1
+    tree.par[1] = 0
+    return tree
+end
+
+# Pushes the nodes of the h top levels of the subtree of x in van Emde Boas order
+function veb_order!(order::Vector{Int}, tree::BinaryTree, x::Int, h::Int)
+    if h == 1
+        push!(order, x)
+        return order
+    end
+    top = h ÷ 2
+    veb_order!(order, tree, x, top)
+    # the subtrees rooted top levels below x, from left to right
+    y, d = x, 0
+    while y != 0
+        d == top && veb_order!(order, tree, y, h - top)
+        y, d = next_preorder(tree, y, d, top, x)
     end
+    return order
 end
@@ -0,0 +1,104 @@
+"""
+    ConcurrentDisjointSet(n)
+
+Disjoint sets of the elements `1:n` which several threads can `find` and
+`merge!` at the same time, without locks, following Anderson and Woll:
+
+- a parent is only changed with an atomic compare-and-swap (CAS);
+- `merge!` links the root with the smaller index below the other root, with a
+  CAS which fails if it is no longer a root (another thread linked it), and
+  then retries from the new roots;
+- `find` does path halving with CAS, which may fail harmlessly.
+
+Parents always have a larger index than their children, so no cycle can
+appear. `merge!(set, edges; ntasks)` merges the pairs of `edges` in `ntasks`
+tasks, e.g. to find the connected components of a graph. `num_sets` must not
+run concurrently with `merge!`.
+
+# Example
+
+```julia
+set = ConcurrentDisjointSet(10^6)
+edges = [(rand(1:10^6), rand(1:10^6)) for _ in 1:10^6]
+merge!(set, edges; ntasks = Threads.nthreads())
+num_sets(set)
+```
+
+# Reference
+- Anderson & Woll, Wait-free parallel algorithms for the union-find problem (1991)
+"""
+struct ConcurrentDisjointSet
+    par::Vector{Int}
+end
+
+ConcurrentDisjointSet(n::Integer) = ConcurrentDisjointSet(collect(1:Int(n)))
+
+Base.length(set::ConcurrentDisjointSet) = length(set.par)
+
+@static if VERSION >= v"1.10"
+    @inline atomic_load(p::Ptr{Int}) = unsafe_load(p, :acquire)
+    @inline atomic_cas!(p::Ptr{Int}, old::Int, new::Int) = unsafe_replace!(p, old, new, :acquire_release, :acquire).success
+else
+    # Before the atomic methods of unsafe_load and unsafe_replace!, with Int and
+    # pointers of the word size of the machine; llvmcall needs the IR as a literal
+    const INT_IR = "i$(Sys.WORD_SIZE)"
+
+    @eval @inline atomic_load(p::Ptr{Int}) = Base.llvmcall($("""
+        %ptr = inttoptr $INT_IR %0 to $INT_IR*
+        %rv = load atomic $INT_IR, $INT_IR* %ptr acquire, align $(sizeof(Int))
+        ret $INT_IR %rv
+        """), Int, Tuple{Ptr{Int}}, p)
+    @eval @inline atomic_cas!(p::Ptr{Int}, old::Int, new::Int) = Base.llvmcall($("""
+        %ptr = inttoptr $INT_IR %0 to $INT_IR*
+        %rs = cmpxchg $INT_IR* %ptr, $INT_IR %1, $INT_IR %2 acq_rel acquire
+        %rv = extractvalue { $INT_IR, i1 } %rs, 1
+        %bv = zext i1 %rv to i8
+        ret i8 %bv
+        """), Bool, Tuple{Ptr{Int}, Int, Int}, p, old, new)
+end
+
+function find(set::ConcurrentDisjointSet, x::Int)
+    par = set.par
+    checkbounds(par, x)
+    GC.@preserve par begin
+        while true
+            px = atomic_load(pointer(par, x))
+            px == x && break
+            gx = atomic_load(pointer(par, px))
+            gx != px && atomic_cas!(pointer(par, x), px, gx)
+            x = gx
+        end
+    end
+    return x
+end
+
+"""
+Merges the sets of `x` and `y`, returns whether they were different sets.
+"""
+function Base.merge!(set::ConcurrentDisjointSet, x::Int, y::Int)
+    par = set.par
+    while true
+        x = find(set, x)
+        y = find(set, y)
+        x == y && return false
+        x > y && ((x, y) = (y, x))
+        linked = GC.@preserve par atomic_cas!(pointer(par, x), x, y)
+        linked && return true
+    end
+end
+
+function Base.merge!(set::ConcurrentDisjointSet, edges::AbstractVector; ntasks::Integer = Threads.nthreads())
+    n = length(edges)
+    # tasks get 1024 edges at least
+    ntasks = clamp(ntasks, 1, max(1, n ÷ 1024))
+    bounds = [firstindex(edges) + (n * t) ÷ ntasks for t in 0:ntasks]
+    @sync for t in 1:ntasks
+        Threads.@spawn for i in bounds[t]:bounds[t+1]-1
+            x, y = edges[i]
+            merge!(set, x, y)
+        end
+    end
+    return set
+end
+
+num_sets(set::ConcurrentDisjointSet) = count(i -> set.par[i] == i, eachindex(set.par))
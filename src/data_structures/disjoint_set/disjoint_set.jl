@@ -1,26 +1,88 @@
 """
-This can contain a maximum of `length(par)` parenting-relations
-par is an array of `Int`, which is the index of the parent node.
+    DisjointSet(n)
+
+Disjoint sets (union-find) of the elements `1:n`, each one alone at first.
+par is an array of `Int`, which is the index of the parent node, the roots
+being their own parents. `size[r]` is the number of elements of the set of
+root `r`, and `nsets` the number of sets.
+
+- `find(set, x)`: root of the set of `x`;
+- `merge!(set, x, y)`: merges the sets of `x` and `y`, `merge!(set, edges)` for all the pairs `(x, y)` of `edges`;
+- `set_size(set, x)`, `num_sets(set)`.
+
+`merge!` links the root of the smaller set below the other one (union by size)
+and `find` makes every other node of the path point to its grandparent (path
+halving), without recursion: the trees stay of logarithmic height, and the
+operations take an almost constant amortized time.
+
+# Example
+
+```julia
+set = DisjointSet(5)
+merge!(set, [(1, 2), (3, 4), (2, 4)])
+find(set, 1) == find(set, 3)   # returns true
+set_size(set, 1)               # returns 4
+num_sets(set)                  # returns 2
+```
 """
 mutable struct DisjointSet
     par::Vector{Int}
+    size::Vector{Int}
+    nsets::Int
     function DisjointSet(size)
         x=[i for i in 1:size]
-        return new(x)
+        return new(x, ones(Int, size), size)
     end
 end
 
+Base.length(set::DisjointSet) = length(set.par)
+
 """
 Find the ancestor of node `x`.
 """
 function find(set::DisjointSet,x::Int)::Int
-    if set.par[x]==x return x
-    else return set.par[x]=find(set,set.par[x])
+    par = set.par
+    checkbounds(par, x)
+    @inbounds while par[x] != x
+        par[x] = par[par[x]]
+        x = par[x]
+        @count find_steps
     end
+    return x
 end
 
+"""
+Merges the sets of `x` and `y` and returns the root of the merged set.
+"""
 function Base.merge!(set::DisjointSet,x::Int,y::Int)
     x=find(set,x)
     y=find(set,y)
+    x == y && return y
+    # x goes below y, unless its set is the larger one
+    set.size[x] > set.size[y] && ((x, y) = (y, x))
     set.par[x]=y
+    set.size[y] += set.size[x]
+    set.nsets -= 1
+    return y
 end
+
+function Base.merge!(set::DisjointSet, edges)
+    for (x, y) in edges
+        merge!(set, x, y)
+    end
+    return set
+end
+
+"""
+    set_size(set, x)
+
+Number of elements in the set of `x`.
+"""
+set_size(set::DisjointSet, x::Int) = set.size[find(set, x)]
+
+"""
+    num_sets(set)
+
+Number of disjoint sets.
+"""
+num_sets(set::DisjointSet) = set.nsets
@@ -0,0 +1,402 @@
+# Keys per node at most; nodes but the root have half as many at least
+const BTREE_NODE_SIZE = 64
+const BTREE_MIN_SIZE = BTREE_NODE_SIZE ÷ 2
+
+mutable struct BPlusNode{K,V}
+    keys::Vector{K}
+    values::Vector{V}                   # leaves: values[i] goes with keys[i]
+    children::Vector{BPlusNode{K,V}}    # inner nodes: the keys of children[i] are in keys[i-1]:keys[i]
+    counts::Vector{Int}                 # inner nodes: number of keys below children[i]
+    next::Union{Nothing,BPlusNode{K,V}} # leaves: the next leaf
+    isleaf::Bool
+end
+
+"""
+    OrderedIndex{K,V}(; lt=isless, by=identity, rev=false)
+    OrderedIndex(keys, values; lt=isless, by=identity, rev=false)
+
+Ordered map from keys of type `K` to values of type `V`, kept in a B+ tree:
+the nodes hold up to `BTREE_NODE_SIZE` sorted keys, searched with a binary
+search, the values are in the leaves only, and the leaves are linked from the
+smallest keys to the largest. A lookup reads `log(n) / log(32)` nodes at most,
+a few consecutive cache lines each, instead of `log2(n)` scattered nodes.
+
+- `index[key] = value` or `insert!(index, key, value)`, `delete!(index, key)`,
+  `index[key]`, `get(index, key, default)` and `haskey(index, key)` take
+  `O(log(n))` time;
+- iterating over `index` gives its `key => value` pairs in order, and
+  `scan(index, lo, hi)` those with `lo <= key <= hi`, walking along the leaves
+  without allocating;
+- the inner nodes also count the keys below each child, for order statistics:
+  `kth(index, k)` is the `k`-th pair, `searchsortedfirst(index, x)` and
+  `searchsortedlast(index, x)` the ranks of `x`, like for a `SortedIndex`.
+
+The second form loads the tree from the sorted, distinct `keys`, filling whole
+nodes, in `O(n)` time.
+
+# Example
+
+```julia
+index = OrderedIndex{Int,String}()
+for (k, v) in [(5, "five"), (1, "one"), (3, "three")]
+    index[k] = v
+end
+index[3]                     # returns "three"
+collect(scan(index, 2, 5))   # returns [3 => "three", 5 => "five"]
+kth(index, 1)                # returns 1 => "one"
+searchsortedfirst(index, 4)  # returns 3, the rank of the first key not before 4
+```
+
+# Reference
+- Comer, The Ubiquitous B-Tree (1979)
+"""
+mutable struct OrderedIndex{K,V,O<:Base.Order.Ordering} <: AbstractBinaryTree
+    root::BPlusNode{K,V}
+    n::Int
+    order::O
+end
+
+leaf_node(keys::Vector{K}, values::Vector{V}) where {K,V} =
+    BPlusNode{K,V}(keys, values, BPlusNode{K,V}[], Int[], nothing, true)
+inner_node(keys::Vector{K}, children::Vector{BPlusNode{K,V}}, counts::Vector{Int}) where {K,V} =
+    BPlusNode{K,V}(keys, V[], children, counts, nothing, false)
+
+key_count(node::BPlusNode) = node.isleaf ? length(node.keys) : sum(node.counts)
+
+function OrderedIndex{K,V}(; lt=isless, by=identity, rev::Bool=false) where {K,V}
+    order = Base.Order.ord(lt, by, rev)
+    return OrderedIndex{K,V,typeof(order)}(leaf_node(K[], V[]), 0, order)
+end
+
+function OrderedIndex(keys::AbstractVector{K}, values::AbstractVector{V}; lt=isless, by=identity, rev::Bool=false) where {K,V}
+    length(keys) == length(values) || throw(DimensionMismatch("$(length(keys)) keys but $(length(values)) values"))
+    order = Base.Order.ord(lt, by, rev)
+    for i in firstindex(keys):lastindex(keys)-1
+        Base.Order.lt(order, keys[i], keys[i+1]) || throw(ArgumentError("OrderedIndex() needs sorted and distinct keys"))
+    end
+    n = length(keys)
+    n <= BTREE_NODE_SIZE && return OrderedIndex{K,V,typeof(order)}(leaf_node(Vector{K}(keys), Vector{V}(values)), n, order)
+
+    # leaves of n / m keys, then m / (BTREE_NODE_SIZE + 1) children per inner node, ...
+    offset = firstindex(keys) - 1
+    m = cld(n, BTREE_NODE_SIZE)
+    level = Vector{BPlusNode{K,V}}(undef, m)
+    for j in 1:m
+        range = offset + 1 + (n * (j - 1)) ÷ m : offset + (n * j) ÷ m
+        level[j] = leaf_node(Vector{K}(keys[range]), Vector{V}(values[range]))
+        j > 1 && (level[j-1].next = level[j])
+    end
+    smallest = [node.keys[1] for node in level]
+    while length(level) > 1
+        m = cld(length(level), BTREE_NODE_SIZE + 1)
+        parents = Vector{BPlusNode{K,V}}(undef, m)
+        for j in 1:m
+            range = 1 + (length(level) * (j - 1)) ÷ m : (length(level) * j) ÷ m
+            children = level[range]
+            parents[j] = inner_node(smallest[range][2:end], children, key_count.(children))
+        end
+        smallest = [smallest[1 + (length(level) * (j - 1)) ÷ m] for j in 1:m]
+        level = parents
+    end
+    return OrderedIndex{K,V,typeof(order)}(level[1], n, order)
+end
+
+Base.length(index::OrderedIndex) = index.n
+Base.isempty(index::OrderedIndex) = index.n == 0
+Base.eltype(::Type{<:OrderedIndex{K,V}}) where {K,V} = Pair{K,V}
+
+function height(index::OrderedIndex)
+    node = index.root
+    h = 0
+    while !node.isleaf
+        node = node.children[1]
+        h += 1
+    end
+    return h
+end
+
+# Child of the inner node in which x is, or would be inserted
+@inline child_index(node::BPlusNode, x, order) = searchsortedlast(node.keys, x, order) + 1
+
+# Leaf in which x is, or would be inserted
+function find_leaf(index::OrderedIndex, x)
+    node = index.root
+    while !node.isleaf
+        node = @inbounds node.children[child_index(node, x, index.order)]
+    end
+    return node
+end
+
+# Position of x in the leaf, 0 if it is not there
+@inline function leaf_position(leaf::BPlusNode, x, order)
+    i = searchsortedfirst(leaf.keys, x, order)
+    return i <= length(leaf.keys) && !Base.Order.lt(order, x, @inbounds leaf.keys[i]) ? i : 0
+end
+
+function Base.get(index::OrderedIndex, key, default)
+    leaf = find_leaf(index, key)
+    i = leaf_position(leaf, key, index.order)
+    return i == 0 ? default : @inbounds leaf.values[i]
+end
+
+function Base.getindex(index::OrderedIndex, key)
+    leaf = find_leaf(index, key)
+    i = leaf_position(leaf, key, index.order)
+    i == 0 && throw(KeyError(key))
+    return @inbounds leaf.values[i]
+end
+
+Base.haskey(index::OrderedIndex, key) = leaf_position(find_leaf(index, key), key, index.order) != 0
+
+function Base.insert!(index::OrderedIndex{K,V}, key, value) where {K,V}
+    node = index.root
+    added, split = insert_into!(node, convert(K, key), convert(V, value), index.order)
+    if split !== nothing
+        separator, right = split
+        index.root = inner_node([separator], [node, right], [key_count(node), key_count(right)])
+    end
+    index.n += added
+    return index
+end
+
+function Base.setindex!(index::OrderedIndex, value, key)
+    insert!(index, key, value)
+    return value
+end
+
+# Inserts or replaces the key in the subtree of node, returns whether it was
+# added and, if node was split, the separator key and the new right node
+function insert_into!(node::BPlusNode{K,V}, key::K, value::V, order) where {K,V}
+    if node.isleaf
+        i = searchsortedfirst(node.keys, key, order)
+        if i <= length(node.keys) && !Base.Order.lt(order, key, node.keys[i])
+            node.values[i] = value
+            return false, nothing
+        end
+        insert!(node.keys, i, key)
+        insert!(node.values, i, value)
+        length(node.keys) <= BTREE_NODE_SIZE && return true, nothing
+        mid = length(node.keys) ÷ 2
+        right = leaf_node(node.keys[mid+1:end], node.values[mid+1:end])
+        resize!(node.keys, mid)
+        resize!(node.values, mid)
+        right.next = node.next
+        node.next = right
+        return true, (right.keys[1], right)
+    end
+
+    c = child_index(node, key, order)
+    child = node.children[c]
+    added, split = insert_into!(child, key, value, order)
+    node.counts[c] += added
+    split === nothing && return added, nothing
+    separator, right = split
+    insert!(node.keys, c, separator)
+    insert!(node.children, c + 1, right)
+    node.counts[c] = key_count(child)
+    insert!(node.counts, c + 1, key_count(right))
+    length(node.keys) <= BTREE_NODE_SIZE && return added, nothing
+    # the middle key moves up
+    mid = length(node.keys) ÷ 2
+    separator = node.keys[mid+1]
+    right = inner_node(node.keys[mid+2:end], node.children[mid+2:end], node.counts[mid+2:end])
+    resize!(node.keys, mid)
+    resize!(node.children, mid + 1)
+    resize!(node.counts, mid + 1)
+    return added, (separator, right)
+end
+
+function Base.delete!(index::OrderedIndex, key)
+    node = index.root
+    removed = delete_from!(node, key, index.order)
+    if !node.isleaf && isempty(node.keys)
+        index.root = node.children[1]
+    end
+    index.n -= removed
+    return index
+end
+
+# Removes the key from the subtree of node, returns whether it was there
+function delete_from!(node::BPlusNode, key, order)
+    if node.isleaf
+        i = leaf_position(node, key, order)
+        i == 0 && return false
+        deleteat!(node.keys, i)
+        deleteat!(node.values, i)
+        return true
+    end
+    c = child_index(node, key, order)
+    removed = delete_from!(node.children[c], key, order)
+    removed || return false
+    node.counts[c] -= 1
+    length(node.children[c].keys) < BTREE_MIN_SIZE && rebalance!(node, c)
+    return true
+end
+
+# Refills the child c of node, which has too few keys, from a sibling, or merges them
+function rebalance!(node::BPlusNode, c::Int)
+    if c > 1 && length(node.children[c-1].keys) > BTREE_MIN_SIZE
+        move_right!(node, c - 1)
+    elseif c < length(node.children) && length(node.children[c+1].keys) > BTREE_MIN_SIZE
+        move_left!(node, c)
+    elseif c > 1
+        merge_children!(node, c - 1)
+    else
+        merge_children!(node, c)
+    end
+    return node
+end
+
+# Moves the last key of the child c to the front of the child c + 1
+function move_right!(node::BPlusNode, c::Int)
+    left, right = node.children[c], node.children[c+1]
+    if left.isleaf
+        pushfirst!(right.keys, pop!(left.keys))
+        pushfirst!(right.values, pop!(left.values))
+        node.keys[c] = right.keys[1]
+        moved = 1
+    else
+        pushfirst!(right.keys, node.keys[c])
+        node.keys[c] = pop!(left.keys)
+        pushfirst!(right.children, pop!(left.children))
+        moved = pop!(left.counts)
+        pushfirst!(right.counts, moved)
+    end
+    node.counts[c] -= moved
+    node.counts[c+1] += moved
+    return node
+end
+
+# Moves the first key of the child c + 1 to the end of the child c
+function move_left!(node::BPlusNode, c::Int)
+    left, right = node.children[c], node.children[c+1]
+    if left.isleaf
+        push!(left.keys, popfirst!(right.keys))
+        push!(left.values, popfirst!(right.values))
+        node.keys[c] = right.keys[1]
+        moved = 1
+    else
+        push!(left.keys, node.keys[c])
+        node.keys[c] = popfirst!(right.keys)
+        push!(left.children, popfirst!(right.children))
+        moved = popfirst!(right.counts)
+        push!(left.counts, moved)
+    end
+    node.counts[c] += moved
+    node.counts[c+1] -= moved
+    return node
+end
+
+# Merges the child c + 1 into the child c
+function merge_children!(node::BPlusNode, c::Int)
+    left, right = node.children[c], node.children[c+1]
+    if left.isleaf
+        append!(left.keys, right.keys)
+        append!(left.values, right.values)
+        left.next = right.next
+    else
+        push!(left.keys, node.keys[c])
+        append!(left.keys, right.keys)
+        append!(left.children, right.children)
+        append!(left.counts, right.counts)
+    end
+    node.counts[c] += node.counts[c+1]
+    deleteat!(node.keys, c)
+    deleteat!(node.children, c + 1)
+    deleteat!(node.counts, c + 1)
+    return node
+end
+
+function first_leaf(index::OrderedIndex)
+    node = index.root
+    while !node.isleaf
+        node = node.children[1]
+    end
+    return node
+end
+
+# The state is the leaf and the position in it
+function Base.iterate(index::OrderedIndex, state = (first_leaf(index), 1))
+    leaf, i = state
+    while i > length(leaf.keys)
+        leaf.next === nothing && return nothing
+        leaf, i = leaf.next, 1
+    end
+    return @inbounds(leaf.keys[i] => leaf.values[i]), (leaf, i + 1)
+end
+
+struct OrderedRange{I<:OrderedIndex,L,H}
+    index::I
+    lo::L
+    hi::H
+end
+
+"""
+    scan(index::OrderedIndex, lo, hi)
+
+Iterator over the `key => value` pairs of `index` with `lo <= key <= hi`, in
+order: the leaf of `lo` is found from the root, then the next pairs are read
+along the linked leaves, without allocating.
+"""
+scan(index::OrderedIndex, lo, hi) = OrderedRange(index, lo, hi)
+
+Base.IteratorSize(::Type{<:OrderedRange}) = Base.SizeUnknown()
+Base.eltype(::Type{<:OrderedRange{I}}) where I = eltype(I)
+
+function Base.iterate(r::OrderedRange)
+    leaf = find_leaf(r.index, r.lo)
+    return iterate(r, (leaf, searchsortedfirst(leaf.keys, r.lo, r.index.order)))
+end
+
+function Base.iterate(r::OrderedRange, state)
+    leaf, i = state
+    while i > length(leaf.keys)
+        leaf.next === nothing && return nothing
+        leaf, i = leaf.next, 1
+    end
+    key = @inbounds leaf.keys[i]
+    Base.Order.lt(r.index.order, r.hi, key) && return nothing
+    return (key => @inbounds leaf.values[i]), (leaf, i + 1)
+end
+
+"""
+    kth(index::OrderedIndex, k)
+
+The `k`-th smallest `key => value` pair of `index`, found by going down the
+children whose counts of keys add up to `k`.
+"""
+function kth(index::OrderedIndex, k::Integer)
+    1 <= k <= index.n || throw(BoundsError(index, k))
+    node = index.root
+    while !node.isleaf
+        c = 1
+        while k > node.counts[c]
+            k -= node.counts[c]
+            c += 1
+        end
+        node = node.children[c]
+    end
+    return node.keys[k] => node.values[k]
+end
+
+# Number of keys before x, or not after x if after is true
+function count_keys(index::OrderedIndex, x, after::Bool)
+    node = index.root
+    order = index.order
+    rank = 0
+    while !node.isleaf
+        c = child_index(node, x, order)
+        for j in 1:c-1
+            rank += node.counts[j]
+        end
+        node = node.children[c]
+    end
+    return rank + (after ? searchsortedlast(node.keys, x, order) : searchsortedfirst(node.keys, x, order) - 1)
+end
+
+Base.searchsortedfirst(index::OrderedIndex, x) = count_keys(index, x, false) + 1
+Base.searchsortedlast(index::OrderedIndex, x) = count_keys(index, x, true)
+
+function Base.show(io::IO, index::OrderedIndex{K,V}) where {K,V}
+    print(io, "OrderedIndex{$K,$V} with $(index.n) entries")
+end
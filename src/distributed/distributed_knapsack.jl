@@ -0,0 +1,33 @@
+"""
+    distributed_knapsack(instances; pool=workers(), batch_size=1024)
+
+Solves the knapsack instances `(capacity, weights, values)` or `(capacity,
+weights, values, counts)` of `instances`, any iterable (e.g. a generator over
+the parameters of a sweep), on the workers of `pool` with `knapsack!`. Returns
+the best value and the copies taken of each item of every instance, in order.
+
+The instances are sent in batches of `batch_size` by `pmap`, to the workers as
+they become free, and each batch is solved by one `KnapsackSolver`, whose
+buffers are reused from an instance to the next.
+
+# Example
+
+```julia
+sweep = ((capacity, [1, 3, 11], [2, 5, 30]) for capacity in 1:10^6)
+results = distributed_knapsack(sweep)
+results[20]   # returns (37, [1, 1, 1])
+```
+"""
+function distributed_knapsack(instances; pool::AbstractVector{<:Integer} = workers(), batch_size::Integer = 1024)
+    batches = (collect(batch) for batch in Iterators.partition(instances, batch_size))
+    results = pmap(solve_knapsacks, WorkerPool(collect(Int, pool)), batches)
+    return isempty(results) ? Tuple{Int,Vector{Int}}[] : reduce(vcat, results)
+end
+
+function solve_knapsacks(batch::Vector)
+    solver = KnapsackSolver{mapreduce(instance -> eltype(instance[3]), promote_type, batch)}()
+    return map(batch) do instance
+        value, taken = knapsack!(solver, instance...)
+        (value, copy(taken))
+    end
+end
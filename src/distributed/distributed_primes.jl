@@ -0,0 +1,54 @@
+"""
+    distributed_primes(limit; pool=workers())
+    distributed_prime_count(limit; pool=workers())
+
+The primes up to `limit`, in increasing order in a `ShardedVector` of `UInt32`
+(`UInt64` beyond `typemax(UInt32)`) left on the workers of `pool`, and their
+number.
+
+The odd numbers up to `limit` are cut into one range per worker, at segment
+boundaries, and each worker sieves its range with the segmented sieve of
+`PrimeTable` on its threads, from the primes up to `√limit` which it finds
+itself. The count keeps no primes, only a segment per thread: it goes to
+`10^12` and beyond in the memory of a laptop, the time being the limit.
+
+# Example
+
+```julia
+distributed_prime_count(10^10)              # returns 455052511
+primes = distributed_primes(10^9)
+mapreduce_shards(last, max, primes)         # returns 999999937
+```
+"""
+function distributed_primes(limit::Integer; pool::AbstractVector{<:Integer} = workers())
+    T = limit <= typemax(UInt32) ? UInt32 : UInt64
+    ranges = sieve_ranges(Int(limit), length(pool))
+    return sharded([remotecall(primes_shard, w, T, Int(limit), r, k == 1) for (k, (w, r)) in enumerate(zip(pool, ranges))], pool)
+end
+
+function distributed_prime_count(limit::Integer; pool::AbstractVector{<:Integer} = workers())
+    ranges = sieve_ranges(Int(limit), length(pool))
+    counts = asyncmap((w, r) -> remotecall_fetch(prime_count_shard, w, Int(limit), r), pool, ranges)
+    return sum(counts) + (limit >= 2)
+end
+
+# Ranges of the odd numbers 2j + 1 <= limit, j >= 1, cut at multiples of SIEVE_SEGMENT
+function sieve_ranges(limit::Int, p::Int)
+    last_odd = max((limit - 1) ÷ 2, 0)
+    nsegments = cld(last_odd, SIEVE_SEGMENT)
+    bounds = [1 + SIEVE_SEGMENT * ((nsegments * k) ÷ p) for k in 0:p]
+    bounds[end] = last_odd + 1
+    return [bounds[k]:bounds[k+1]-1 for k in 1:p]
+end
+
+# The primes 2j + 1 for j in r, with 2 first for the first shard
+function primes_shard(::Type{T}, limit::Int, r::UnitRange{Int}, first_shard::Bool) where T
+    base_primes = odd_primes_upto(isqrt(max(limit, 0)))
+    parts = sieve_tasks((lo, hi) -> odd_primes_between(T, base_primes, lo, hi), first(r), last(r), Threads.nthreads())
+    return vcat(first_shard && limit >= 2 ? T[2] : T[], parts...)
+end
+
+function prime_count_shard(limit::Int, r::UnitRange{Int})
+    base_primes = odd_primes_upto(isqrt(max(limit, 0)))
+    return sum(sieve_tasks((lo, hi) -> count_odd_primes_between(base_primes, lo, hi), first(r), last(r), Threads.nthreads()))
+end
@@ -0,0 +1,67 @@
+"""
+    distributed_sort(x::ShardedVector; oversampling=64, lt=isless, by=identity, rev=false)
+    distributed_sort(x::AbstractVector; pool=workers(), kwargs...)
+
+Sorts the shards of `x` across their workers with a sample sort, returning a
+`ShardedVector` whose shards are sorted and in order; the second form shards
+the vector over `pool` and `collect`s the result. The `p` workers:
+
+1. sort their shard with `ParallelSort!`, on their threads, and send back
+   `max(oversampling, p)` evenly spaced elements of it;
+2. the `p - 1` splitters are taken evenly spaced from all these samples, which
+   (regular sampling) leaves at most about `2n/p` elements between two of them;
+3. worker `k` fetches the elements between splitters `k - 1` and `k` of every
+   sorted shard straight from the worker holding it, and merges these `p`
+   sorted runs into its shard of the result.
+
+Each element crosses the network once, and the calling process only sees the
+samples. Equal elements all go to the same shard, so heavily repeated keys
+unbalance it. `lt`, `by` and `rev` have the same meaning as for `sort!`, and
+must be defined on the workers.
+
+# Example
+
+```julia
+x = ShardedVector(r -> rand(length(r)), 10^9)
+y = distributed_sort(x)
+issorted(collect(y))   # returns true
+```
+
+# Reference
+- Shi & Schaeffer, Parallel sorting by regular sampling (1992)
+"""
+function distributed_sort(x::ShardedVector{T}; oversampling::Integer = 64, lt = isless, by = identity, rev::Bool = false) where T
+    o = Base.Order.ord(lt, by, rev)
+    p = length(x.shards)
+    sorted = map_shards(shard -> ParallelSort!(collect(shard); lt = lt, by = by, rev = rev), x)
+    p == 1 && return sorted
+
+    samples = sort!(reduce(vcat, on_shards(regular_sample, sorted, max(oversampling, p))); lt = lt, by = by, rev = rev)
+    isempty(samples) && return sorted
+    splitters = [samples[cld(length(samples) * k, p)] for k in 1:p-1]
+    # bucket k of shard i is cuts[i][k]+1:cuts[i][k+1]
+    cuts = on_shards(bucket_cuts, sorted, splitters, o)
+    buckets = [remotecall(merge_bucket, sorted.workers[k], sorted, [c[k]+1:c[k+1] for c in cuts], o) for k in 1:p]
+    foreach(wait, buckets)
+    return ShardedVector{T}(buckets, copy(sorted.workers), [sum(c -> c[k+1] - c[k], cuts) for k in 1:p])
+end
+
+distributed_sort(x::AbstractVector; pool::AbstractVector{<:Integer} = workers(), kwargs...) =
+    collect(distributed_sort(ShardedVector(x; pool = pool); kwargs...))
+
+# k evenly spaced elements of x
+regular_sample(x::AbstractVector, k::Int) = [x[1 + div((i - 1) * length(x), k)] for i in 1:min(k, length(x))]
+
+bucket_cuts(x::AbstractVector, splitters::AbstractVector, o::Base.Order.Ordering) =
+    [0; [searchsortedlast(x, s, o) for s in splitters]; length(x)]
+
+# Fetches and merges the sorted runs shard[ranges[i]] of the shards of s
+function merge_bucket(s::ShardedVector{T}, ranges::Vector{UnitRange{Int}}, o::Base.Order.Ordering) where T
+    runs = asyncmap((w, ref, r) -> remotecall_fetch(apply_shard, w, getindex, ref, r), s.workers, s.shards, ranges)
+    bucket = Vector{T}(undef, sum(length, ranges))
+    bounds = [0; cumsum(length.(ranges))]
+    for (run, b) in zip(runs, bounds)
+        copyto!(bucket, b + 1, run, 1, length(run))
+    end
+    return merge_runs!(bucket, similar(bucket), bounds, o, Threads.nthreads())
+end
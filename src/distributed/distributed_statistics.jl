@@ -0,0 +1,44 @@
+"""
+    distributed_fit(acc, x::ShardedVector)
+    distributed_fit(acc, read, n; pool=workers(), block_size=2^20)
+
+Fits a copy of the empty accumulator `acc` to the data of each worker, where
+the data is, and combines them with `merge!` into a new accumulator: `Moments`,
+`CoMoments`, `CountMinSketch` or any other with `fit!` and `merge!` methods.
+Only the accumulators are sent back, and `acc` itself is left as it is.
+
+The first form fits the shards of `x`. The second one streams the data: the
+range of `1:n` of each worker is cut into blocks of `block_size` indices `r`,
+which are read by `read(r)`, e.g. from a memory mapped file, and fitted one
+after the other, so that a worker holds one block at a time. `read` returns a
+vector, or a tuple of vectors for `CoMoments`. `Moments` and `CoMoments` are
+fitted on the threads of the workers.
+
+# Example
+
+```julia
+# a binary file of 2^37 Float64 (1 TiB), on a file system shared by the workers
+@everywhere read_block(r) = open(io -> (seek(io, 8 * (first(r) - 1)); read!(io, Vector{Float64}(undef, length(r)))), "/data/x.bin")
+acc = distributed_fit(Moments{Float64}(), read_block, 2^37)
+mean(acc), variance(acc)
+```
+"""
+distributed_fit(acc, x::ShardedVector) = mapreduce_shards(shard -> fit_block!(deepcopy(acc), shard), merge!, x)
+
+function distributed_fit(acc, read, n::Integer; pool::AbstractVector{<:Integer} = workers(), block_size::Integer = 1 << 20)
+    block_size > 0 || throw(ArgumentError("block_size must be positive"))
+    parts = asyncmap((w, r) -> remotecall_fetch(fit_blocks, w, acc, read, r, Int(block_size)), pool, shard_ranges(Int(n), length(pool)))
+    return reduce(merge!, parts)
+end
+
+function fit_blocks(acc, read, r::UnitRange{Int}, block_size::Int)
+    acc = deepcopy(acc)
+    for block in Iterators.partition(r, block_size)
+        data = read(block)
+        data isa Tuple ? fit_block!(acc, data...) : fit_block!(acc, data)
+    end
+    return acc
+end
+
+fit_block!(acc::Union{Moments,CoMoments}, data::AbstractVector...) = fit!(acc, data...; ntasks = Threads.nthreads())
+fit_block!(acc, data...) = fit!(acc, data...)
@@ -0,0 +1,93 @@
+"""
+    ShardedVector(x::AbstractVector; pool=workers())
+    ShardedVector(f, n::Integer; pool=workers())
+
+A vector cut into contiguous shards which stay on Distributed.jl workers, one
+per worker of `pool`. The `distributed_*` functions work on the shards where
+they are, `map_shards` and `mapreduce_shards` run any function on them, and
+`collect` brings the whole vector back.
+
+The first form sends the shards of `x` one after the other, so that a single
+shard is copied at a time. The second one ships no data at all: each worker
+builds its shard `f(r)` from its range `r` of `1:n`, e.g. by generating it or
+reading it from a file. This package (and `f`) must be loaded on the workers,
+with `@everywhere using TheAlgorithms`. Without workers, `workers()` is the
+master process alone, which then holds the only shard.
+
+# Example
+
+```julia
+using Distributed
+addprocs(4)
+@everywhere using TheAlgorithms
+
+x = ShardedVector(r -> rand(length(r)), 10^8)  # 4 shards of 2.5 * 10^7 values
+length(x)                                     # returns 10^8
+mapreduce_shards(maximum, max, x)             # only the 4 maxima are sent back
+```
+"""
+struct ShardedVector{T}
+    shards::Vector{Future} # shard k is fetch(shards[k]) on workers[k]
+    workers::Vector{Int}
+    lengths::Vector{Int}
+end
+
+function ShardedVector(x::AbstractVector; pool::AbstractVector{<:Integer} = workers())
+    Base.require_one_based_indexing(x)
+    ranges = shard_ranges(length(x), length(pool))
+    shards = [remotecall_wait(identity, w, x[r]) for (w, r) in zip(pool, ranges)]
+    return ShardedVector{eltype(x)}(shards, collect(Int, pool), length.(ranges))
+end
+
+ShardedVector(f, n::Integer; pool::AbstractVector{<:Integer} = workers()) =
+    sharded([remotecall(f, w, r) for (w, r) in zip(pool, shard_ranges(Int(n), length(pool)))], pool)
+
+# The ShardedVector of the shards being computed on workers, once they are done
+function sharded(shards::Vector{Future}, workers::AbstractVector{<:Integer})
+    types_lengths = asyncmap((ref, w) -> remotecall_fetch(shard_type_length, w, ref), shards, workers)
+    T = first(types_lengths[1])
+    all(tl -> first(tl) == T, types_lengths) || throw(ArgumentError("the shards have different element types"))
+    return ShardedVector{T}(shards, collect(Int, workers), last.(types_lengths))
+end
+
+shard_type_length(ref::Future) = (x = fetch(ref); (eltype(x), length(x)))
+
+# Cuts 1:n in p contiguous ranges
+shard_ranges(n::Int, p::Int) = [div((k - 1) * n, p)+1:div(k * n, p) for k in 1:p]
+
+# On the worker holding ref
+apply_shard(f, ref::Future, args...) = f(fetch(ref), args...)
+
+Base.length(s::ShardedVector) = sum(s.lengths)
+Base.eltype(::Type{ShardedVector{T}}) where T = T
+
+"""
+    map_shards(f, s::ShardedVector)
+
+The `ShardedVector` of the vectors `f(shard)`, computed and kept on the
+workers holding the shards of `s`.
+"""
+map_shards(f, s::ShardedVector) = sharded([remotecall(apply_shard, w, f, ref) for (w, ref) in zip(s.workers, s.shards)], s.workers)
+
+"""
+    mapreduce_shards(f, op, s::ShardedVector)
+
+Reduces the values `f(shard)`, computed on the workers holding the shards of
+`s`, with `op` on the calling process: only these values are sent to it.
+"""
+mapreduce_shards(f, op, s::ShardedVector) = reduce(op, on_shards(f, s))
+
+# f(shard, args...) for each shard of s, on its worker
+on_shards(f, s::ShardedVector, args...) =
+    asyncmap((w, ref) -> remotecall_fetch(apply_shard, w, f, ref, args...), s.workers, s.shards)
+
+function Base.collect(s::ShardedVector{T}) where T
+    x = Vector{T}(undef, length(s))
+    offset = 0
+    for (w, ref, n) in zip(s.workers, s.shards, s.lengths)
+        # rather than fetch(ref), which would keep a copy of the shard in ref
+        copyto!(x, offset + 1, remotecall_fetch(fetch, w, ref), 1, n)
+        offset += n
+    end
+    return x
+end
@@ -0,0 +1,206 @@
+"""
+    enable_instrumentation(on=true)
+
+Turns the instrumentation of the algorithms on or off. When it is on, they
+count their elementary operations, and the timed sections record their calls,
+time and allocations; `report` prints them, `instrumentation_counts` returns
+the counts and `reset_instrumentation!` sets everything back to zero.
+
+The counters are:
+
+- `comparisons`: comparisons of elements in the sorts
+- `swaps`: exchanges of two elements in the sorts
+- `probes`: elements read by `binary_search`, `interpolation_search` and `jump_search`
+- `find_steps`: parents followed by `find` in a `DisjointSet`
+- `dp_updates`: cells updated in the table of `zero_one_pack!`
+
+Instrumentation is off by default and then compiles to nothing: the switch is
+the method `instrumentation_enabled()`, which returns a constant, so turning
+it on redefines the method and recompiles the functions which depend on it.
+Each thread has its own counters; the allocations of a section are those of
+the whole process while it runs.
+
+# Example
+
+```julia
+enable_instrumentation()
+x = rand(10^4)
+QuickSort!(x)
+instrumentation_counts().comparisons   # ≈ 1.2 * 10^4 * log2(10^4)
+report()                               # table of the counters and sections
+report(stdout; format = :json)
+enable_instrumentation(false)
+```
+"""
+function enable_instrumentation(on::Bool = true)
+    Core.eval(@__MODULE__, :(instrumentation_enabled() = $on))
+    return on
+end
+
+instrumentation_enabled() = false
+
+const COUNTER_NAMES = (:comparisons, :swaps, :probes, :find_steps, :dp_updates)
+
+# Counts of each thread, in the columns of a matrix padded to 128 bytes per
+# column so that two threads never write the same cache line
+const COUNTS = Ref(zeros(Int, 16, 1))
+
+# name => (calls, nanoseconds, bytes) of the sections of each thread
+const SECTIONS = Ref([Dict{String,NTuple{3,Int}}()])
+
+function __init__()
+    nthreads = @static VERSION >= v"1.9" ? Threads.maxthreadid() : Threads.nthreads()
+    COUNTS[] = zeros(Int, 16, nthreads)
+    SECTIONS[] = [Dict{String,NTuple{3,Int}}() for _ in 1:nthreads]
+end
+
+"""
+    @count name [n]
+
+Adds `n`, 1 by default, to the counter `name` of this thread, when the
+instrumentation is on.
+"""
+macro count(name::Symbol, n = 1)
+    k = findfirst(==(name), COUNTER_NAMES)
+    k === nothing && throw(ArgumentError("unknown counter $name, expected one of $COUNTER_NAMES"))
+    return :(instrumentation_enabled() && add_count!($k, $(esc(n))); nothing)
+end
+
+@inline function add_count!(k::Int, n::Integer)
+    counts = COUNTS[]
+    t = Threads.threadid()
+    # threads adopted after __init__ are not counted
+    t <= size(counts, 2) && @inbounds counts[k, t] += n
+    return nothing
+end
+
+"""
+    @section name expr
+
+Evaluates `expr` and, when the instrumentation is on, records its time and
+allocations in the section `name`.
+"""
+macro section(name, expr)
+    return quote
+        if instrumentation_enabled()
+            local t0, b0 = time_ns(), Base.gc_bytes()
+            local value = $(esc(expr))
+            record_section!($(esc(name)), time_ns() - t0, Base.gc_bytes() - b0)
+            value
+        else
+            $(esc(expr))
+        end
+    end
+end
+
+function record_section!(name::String, time::Integer, bytes::Integer)
+    sections = SECTIONS[]
+    t = Threads.threadid()
+    t <= length(sections) || return nothing
+    calls, total_time, total_bytes = get(sections[t], name, (0, 0, 0))
+    sections[t][name] = (calls + 1, total_time + Int(time), total_bytes + Int(bytes))
+    return nothing
+end
+
+# Comparisons of a sort, counted through its ordering
+struct CountingOrdering{O<:Base.Order.Ordering} <: Base.Order.Ordering
+    order::O
+end
+
+@inline function Base.Order.lt(c::CountingOrdering, a, b)
+    @count comparisons
+    return Base.Order.lt(c.order, a, b)
+end
+
+# The ordering o, counting its comparisons when the instrumentation is on
+counting(o::Base.Order.Ordering) = instrumentation_enabled() ? CountingOrdering(o) : o
+counting(o::CountingOrdering) = o
+
+"""
+    instrumentation_counts()
+
+The counters of the instrumentation, summed over the threads, as a named tuple.
+"""
+function instrumentation_counts()
+    counts = COUNTS[]
+    return NamedTuple{COUNTER_NAMES}(ntuple(k -> sum(view(counts, k, :)), length(COUNTER_NAMES)))
+end
+
+"""
+    instrumentation_sections()
+
+The sections of the instrumentation, summed over the threads, as a dictionary
+of their names to named tuples of their number of calls, time in nanoseconds
+and allocations in bytes.
+"""
+function instrumentation_sections()
+    sections = Dict{String,NamedTuple{(:calls, :time, :bytes),NTuple{3,Int}}}()
+    for thread in SECTIONS[], (name, (calls, time, bytes)) in thread
+        previous = get(sections, name, (calls = 0, time = 0, bytes = 0))
+        sections[name] = (calls = previous.calls + calls, time = previous.time + time, bytes = previous.bytes + bytes)
+    end
+    return sections
+end
+
+"""
+    reset_instrumentation!()
+
+Sets the counters of the instrumentation to zero and forgets its sections.
+"""
+function reset_instrumentation!()
+    fill!(COUNTS[], 0)
+    foreach(empty!, SECTIONS[])
+    return nothing
+end
+
+"""
+    report(io=stdout; format=:table)
+
+Prints the counters and sections of the instrumentation, as a table, or as a
+JSON object `{"counters": {name: count}, "sections": {name: {"calls", "time_ns", "bytes"}}}`
+for `format = :json`.
+"""
+function report(io::IO = stdout; format::Symbol = :table)
+    counts = instrumentation_counts()
+    sections = sort!(collect(instrumentation_sections()); by = first)
+    if format == :json
+        print(io, "{\"counters\": {")
+        join(io, ("\"$name\": $(counts[name])" for name in COUNTER_NAMES), ", ")
+        print(io, "}, \"sections\": {")
+        join(io, ("$(json_string(name)): {\"calls\": $(s.calls), \"time_ns\": $(s.time), \"bytes\": $(s.bytes)}"
+            for (name, s) in sections), ", ")
+        println(io, "}}")
+    elseif format == :table
+        instrumentation_enabled() || println(io, "(instrumentation is off, see enable_instrumentation)")
+        println(io, rpad("counter", 24), lpad("count", 16))
+        for name in COUNTER_NAMES
+            println(io, rpad(name, 24), lpad(counts[name], 16))
+        end
+        if !isempty(sections)
+            println(io)
+            println(io, rpad("section", 24), lpad("calls", 16), lpad("time (ms)", 16), lpad("allocated (bytes)", 20))
+            for (name, s) in sections
+                println(io, rpad(name, 24), lpad(s.calls, 16), lpad(round(s.time / 1e6; digits = 3), 16), lpad(s.bytes, 20))
+            end
+        end
+    else
+        throw(ArgumentError("unknown format $format, expected :table or :json"))
+    end
+    return nothing
+end
+
+function json_string(s::AbstractString)
+    io = IOBuffer()
+    print(io, '"')
+    for c in s
+        if c == '"' || c == '\\'
+            print(io, '\\', c)
+        elseif c < ' '
+            print(io, "\\u", string(UInt16(c); base = 16, pad = 4))
+        else
+            print(io, c)
+        end
+    end
+    print(io, '"')
+    return String(take!(io))
+end
@@ -15,6 +15,7 @@ julia> zero_one_pack!(20,[1,3,11],[2,5,30],dp)
 function zero_one_pack!(capacity::N, weights::V, values::V, dp::V
 ) where {N <: Number,V <: AbstractVector}
     for i in 1:length(weights)
+        @count dp_updates max(capacity - weights[i], 0) + 1
         j = capacity
         while j > weights[i] # reversed loop
             dp[j] = max(dp[j], dp[j - weights[i]] + values[i])
@@ -25,6 +26,25 @@ function zero_one_pack!(capacity::N, weights::V, values::V, dp::V
     return dp[capacity]
 end
 
+"""
+    zero_one_pack!(ws::Workspace, capacity, weights, values)
+    complete_pack!(ws::Workspace, capacity, weights, values)
+
+Same knapsacks with the `dp` array in a vector of the workspace `ws`, sized
+and zeroed here, which allocates nothing once it has grown to the capacity.
+"""
+zero_one_pack!(ws::Workspace, capacity::Number, weights::AbstractVector, values::AbstractVector) =
+    zero_one_pack!(capacity, weights, values, knapsack_table!(ws, capacity, weights, values))
+
+complete_pack!(ws::Workspace, capacity::Number, weights::AbstractVector, values::AbstractVector) =
+    complete_pack!(capacity, weights, values, knapsack_table!(ws, capacity, weights, values))
+
+# dp[weights[i]] is written even for the items heavier than the capacity
+function knapsack_table!(ws::Workspace, capacity, weights, values)
+    n = isempty(weights) ? capacity : max(capacity, maximum(weights))
+    return fill!(acquire!(ws, Vector{eltype(values)}, n), zero(eltype(values)))
+end
+
 """
 This does complete/infinite (each item can be chosen infinite times) knapsack :
 pack capacity = capacity
@@ -0,0 +1,182 @@
+"""
+    KnapsackSolver{T}()
+    KnapsackSolver()
+
+Workspace for `knapsack!`, to solve many knapsack instances with values of type
+`T` (`Int` by default) without allocating anew: the buffers grow to the largest
+capacity and number of items seen, and are reused.
+
+# Example
+
+```julia
+solver = KnapsackSolver()
+value, taken = knapsack!(solver, 20, [1, 3, 11], [2, 5, 30])  # returns 37, [1, 1, 1]
+value, taken = knapsack!(solver, 20, [1, 2, 9], [1, 3, 20], [5, 5, 2])  # returns 43, [0, 1, 2]
+```
+"""
+struct KnapsackSolver{T<:Real}
+    prev::Vector{T}           # best values of the previous row, by capacity 0:capacity
+    next::Vector{T}           # best values of the current row
+    decisions::Vector{UInt64} # bit j of row p: piece p is taken at capacity j
+    piece_item::Vector{Int}   # item of each piece
+    piece_count::Vector{Int}  # copies of the item in each piece
+    piece_weight::Vector{Int}
+    taken::Vector{Int}        # copies of each item in the solution
+end
+
+KnapsackSolver{T}() where T = KnapsackSolver{T}(T[], T[], UInt64[], Int[], Int[], Int[], Int[])
+KnapsackSolver() = KnapsackSolver{Int}()
+
+"""
+    knapsack!(solver, capacity, weights, values[, counts]; ntasks=Threads.nthreads())
+
+Best total value of the items fitting in `capacity`, with item `i` of weight
+`weights[i] > 0` and value `values[i]`, available once (0-1 knapsack) or
+`counts[i]` times (bounded knapsack, `typemax(Int)` meaning any number of
+times). Returns the value and the number of copies taken of each item, a vector
+which belongs to `solver` and is overwritten by the next call.
+
+The `counts[i]` copies of an item are split into pieces of 1, 2, 4, ... copies
+(binary splitting), which can make any number of them, and each piece is a 0-1
+item of the dynamic programming. A row of it stores the best values for all
+the capacities from those of the previous row, `next[j] = max(prev[j],
+prev[j - w] + v)`, so that the capacities have no dependency between them: they
+are processed 64 at a time, the comparisons giving a word of the decision
+table (1 bit per piece and capacity), and the words are shared out between
+`ntasks` tasks for large capacities. The taken items are read back from the
+decision table, from the last piece to the first.
+"""
+function knapsack!(s::KnapsackSolver{T}, capacity::Integer, weights::AbstractVector{<:Integer},
+        values::AbstractVector{<:Real}, counts::Union{AbstractVector{<:Integer},Nothing} = nothing;
+        ntasks::Integer = Threads.nthreads()) where T
+    n = length(weights)
+    length(values) == n || throw(DimensionMismatch("$n weights but $(length(values)) values"))
+    counts === nothing || length(counts) == n || throw(DimensionMismatch("$n weights but $(length(counts)) counts"))
+    capacity >= 0 || throw(ArgumentError("the capacity must be non negative"))
+    all(w -> w > 0, weights) || throw(ArgumentError("the weights must be positive"))
+    capacity = Int(capacity)
+    split_items!(s, capacity, weights, counts)
+
+    npieces = length(s.piece_item)
+    nwords = cld(capacity + 1, 64)
+    resize!(s.prev, capacity + 1)
+    resize!(s.next, capacity + 1)
+    resize!(s.decisions, nwords * npieces)
+    fill!(s.prev, zero(T))
+    # tasks get 1024 words (2^16 capacities) at least
+    ntasks = clamp(ntasks, 1, max(1, nwords ÷ 1024))
+    for p in 1:npieces
+        v = T(values[s.piece_item[p]]) * s.piece_count[p]
+        src, dst = isodd(p) ? (s.prev, s.next) : (s.next, s.prev)
+        knapsack_rows!(dst, src, s.decisions, (p - 1) * nwords, s.piece_weight[p], v, nwords, ntasks)
+    end
+    best = isodd(npieces) ? s.next[capacity + 1] : s.prev[capacity + 1]
+
+    resize!(s.taken, n)
+    fill!(s.taken, 0)
+    j = capacity
+    for p in npieces:-1:1
+        if (s.decisions[(p - 1) * nwords + (j >> 6) + 1] >> (j & 63)) & 1 == 1
+            s.taken[s.piece_item[p]] += s.piece_count[p]
+            j -= s.piece_weight[p]
+        end
+    end
+    return best, s.taken
+end
+
+# Pieces of 1, 2, 4, ... and the remaining copies of each item, those heavier than capacity left out
+function split_items!(s::KnapsackSolver, capacity::Int, weights, counts)
+    empty!(s.piece_item)
+    empty!(s.piece_count)
+    empty!(s.piece_weight)
+    for i in eachindex(weights)
+        w = Int(weights[i])
+        left = min(counts === nothing ? 1 : Int(counts[i]), capacity ÷ w)
+        k = 1
+        while left > 0
+            c = min(k, left)
+            push!(s.piece_item, i)
+            push!(s.piece_count, c)
+            push!(s.piece_weight, c * w)
+            left -= c
+            k *= 2
+        end
+    end
+    return s
+end
+
+function knapsack_rows!(next, prev, decisions, offset, w, v, nwords, ntasks)
+    if ntasks == 1
+        knapsack_row!(next, prev, decisions, offset, w, v, 1, nwords)
+    else
+        bounds = [1 + (nwords * t) ÷ ntasks for t in 0:ntasks]
+        @sync for t in 1:ntasks
+            Threads.@spawn knapsack_row!(next, prev, decisions, offset, w, v, bounds[t], bounds[t+1] - 1)
+        end
+    end
+    return next
+end
+
+# Capacities 64(k - 1):64k - 1 of a row, for k in first:last
+function knapsack_row!(next::Vector{T}, prev::Vector{T}, decisions::Vector{UInt64}, offset::Int,
+        w::Int, v::T, first::Int, last::Int) where T
+    capacity = length(prev) - 1
+    @inbounds for k in first:last
+        j0 = 64 * (k - 1)
+        word = zero(UInt64)
+        for b in 0:min(63, capacity - j0)
+            j = j0 + b
+            old = prev[j + 1]
+            candidate = prev[max(j - w, 0) + 1] + v
+            take = (j >= w) & (candidate > old)
+            next[j + 1] = ifelse(take, candidate, old)
+            word |= UInt64(take) << b
+        end
+        decisions[offset + k] = word
+    end
+    return next
+end
+
+"""
+    subset_sums(capacity, weights)
+    subset_sums!(reachable::BitVector, weights)
+
+Which sums `0:capacity` of a subset of `weights` (each one used at most once)
+are possible, as a `BitVector` whose element `s + 1` is the sum `s`.
+`subset_sums!` overwrites `reachable`, of length `capacity + 1`.
+
+Adding a weight `w` is `reachable |= reachable << w` on the 64-bit chunks of
+the `BitVector`, 64 sums at a time, from the last chunk to the first so that
+each weight is used once.
+
+# Example
+
+```julia
+findall(subset_sums(10, [3, 5])) .- 1   # returns [0, 3, 5, 8]
+```
+"""
+subset_sums(capacity::Integer, weights::AbstractVector{<:Integer}) = subset_sums!(falses(capacity + 1), weights)
+
+function subset_sums!(reachable::BitVector, weights::AbstractVector{<:Integer})
+    all(w -> w >= 0, weights) || throw(ArgumentError("the weights must be non negative"))
+    fill!(reachable, false)
+    isempty(reachable) && return reachable
+    reachable[1] = true
+    chunks = reachable.chunks
+    nchunks = length(chunks)
+    for w in weights
+        q, r = divrem(Int(w), 64)
+        q >= nchunks && continue
+        @inbounds for k in nchunks:-1:q+1
+            shifted = chunks[k - q] << r
+            if r > 0 && k - q > 1
+                shifted |= chunks[k - q - 1] >> (64 - r)
+            end
+            chunks[k] |= shifted
+        end
+    end
+    # clear the bits past the end of the last chunk
+    rest = length(reachable) & 63
+    rest != 0 && (chunks[nchunks] &= (one(UInt64) << rest) - one(UInt64))
+    return reachable
+end
@@ -7,20 +7,16 @@ Arguments:
  - x_start: starting value for x
  - x_end: ending value for x
  - steps: steps taken while integrating.
-"""
 
+The area is signed: it is negative where `f` is. See `trapezoid` and
+`simpson` for sampled functions, `gauss_kronrod` and `romberg` for adaptive
+integration.
+"""
 function trapazoidal_area(f, x_start, x_end, steps)
-	x1 = x_start
-	fx1 = f(x_start)
-	area = 0.0
-
-	for _ in 1:steps
-		x2 = ((x_end - x_start) / steps) + x1
-		fx2 = f(x2)
-		area += abs(fx2 + fx1) * (x2 - x1) / 2
-		x1 = x2
-		fx1 = fx2
-	end
-
-	return area
+    h = (x_end - x_start) / steps
+    area = (f(x_start) + f(x_end)) / 2
+    for i in 1:steps-1
+        area += f(x_start + i * h)
+    end
+    return area * h
 end
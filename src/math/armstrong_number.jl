@@ -31,3 +31,16 @@ function is_armstrong(x)
         return x == result ? true : false
     end
 end
+
+# Integer digits, with the powers summed in a wider type so that they cannot overflow
+function is_armstrong(x::Integer)
+    x < 0 && return false
+    n = ndigits(x)
+    result = zero(widen(typeof(x)))
+    temp = x
+    while temp > 0
+        temp, digit = divrem(temp, 10)
+        result += widen(digit)^n
+    end
+    return result == x
+end
@@ -11,11 +11,121 @@ median([2, 70, 6, 50, 20, 8, 4])    # returns 8
 median([0])                         # returns 0
 ```
 
+`median!` computes it in place, by selection in `O(n)` instead of sorting.
+
 Contributed By:- [Ashwani Rathee](https://github.com/ashwani-rathee)
 """
-function median(nums)
-    sorted = sort(nums)
-    len = length(sorted)
-    mid_index = Int(floor_val(len / 2))
-    return len % 2 == 0 ? (sorted[mid_index + 1] + sorted[mid_index]) / 2 : sorted[mid_index + 1]
+median(nums) = median!(collect(nums))
+
+"""
+    median!(v)
+    quantile!(v, p)
+    quantile(v, p)
+
+Median, and quantile of order `0 <= p <= 1`, of the vector `v`, reordered in
+place by `median!` and `quantile!`. The quantile interpolates linearly between
+the order statistics `k = floor(h)` and `k + 1`, `h = (n - 1)p + 1` (the usual
+definition, known as type 7), and the median is `quantile!(v, 0.5)`.
+
+No sorting is needed: the `k`-th smallest value is selected by introselect,
+in `O(n)` average and `O(n log(n))` worst case time, and the next one is the
+minimum of the elements after it. The result is `NaN` if `v` has any.
+
+# Example
+
+```julia
+v = [2, 70, 6, 50, 20, 8, 4]
+median!(v)           # returns 8
+quantile!(v, 0.25)   # returns 5.0
+```
+
+# Reference
+- Musser, Introspective sorting and selection algorithms (1997)
+"""
+function median!(v::AbstractVector)
+    isempty(v) && throw(ArgumentError("median of an empty collection"))
+    has_nan(v) && return oftype(float(first(v)), NaN)
+    n = length(v)
+    k = (n + 1) ÷ 2
+    x = select!(v, k)
+    isodd(n) && return x
+    return (x + minimum_after(v, k)) / 2
+end
+
+function quantile!(v::AbstractVector, p::Real)
+    isempty(v) && throw(ArgumentError("quantile of an empty collection"))
+    0 <= p <= 1 || throw(ArgumentError("the order of a quantile must be in [0, 1]"))
+    has_nan(v) && return oftype(float(first(v)), NaN)
+    n = length(v)
+    h = (n - 1) * p + 1
+    k = floor(Int, h)
+    x = select!(v, k)
+    k == n && return float(x)
+    return x + (h - k) * (minimum_after(v, k) - x)
+end
+
+quantile(v, p::Real) = quantile!(collect(v), p)
+
+has_nan(v::AbstractVector{<:AbstractFloat}) = any(isnan, v)
+has_nan(v::AbstractVector) = false
+
+# Smallest element after the k-th one, which select! put in place
+function minimum_after(v::AbstractVector, k::Int)
+    i = firstindex(v) + k
+    m = v[i]
+    for j in i+1:lastindex(v)
+        isless(v[j], m) && (m = v[j])
+    end
+    return m
+end
+
+"""
+    select!(v, k)
+
+Puts the `k`-th smallest element of `v` at index `k`, the smaller ones before
+it and the larger ones after it, and returns it: quickselect with the median
+of 3 as pivot, which falls back to sorting the part left if it has not shrunk
+enough after `2 log2(n)` partitions.
+"""
+function select!(v::AbstractVector, k::Integer)
+    Base.require_one_based_indexing(v)
+    lo, hi = 1, length(v)
+    1 <= k <= hi || throw(BoundsError(v, k))
+    depth = 2 * (8 * sizeof(hi) - leading_zeros(hi))
+    @inbounds while lo < hi
+        if depth == 0
+            sort!(view(v, lo:hi); lt = isless)
+            break
+        end
+        depth -= 1
+        # median of the first, middle and last elements
+        mid = (lo + hi) >>> 1
+        isless(v[mid], v[lo]) && ((v[mid], v[lo]) = (v[lo], v[mid]))
+        isless(v[hi], v[mid]) && ((v[hi], v[mid]) = (v[mid], v[hi]))
+        isless(v[mid], v[lo]) && ((v[mid], v[lo]) = (v[lo], v[mid]))
+        pivot = v[mid]
+        # Hoare partition: v[lo:j] <= pivot <= v[i:hi], and v[j+1:i-1] == pivot
+        i, j = lo, hi
+        while i <= j
+            while isless(v[i], pivot)
+                i += 1
+            end
+            while isless(pivot, v[j])
+                j -= 1
+            end
+            if i <= j
+                v[i], v[j] = v[j], v[i]
+                i += 1
+                j -= 1
+            end
+        end
+        if k <= j
+            hi = j
+        elseif k >= i
+            lo = i
+        else
+            break
+        end
+    end
+    return v[k]
 end
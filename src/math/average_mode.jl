@@ -8,32 +8,51 @@ Finds mode of a vector of numbers
 ```julia
 mode([2, 3, 4, 5, 3, 4, 2, 5, 2, 2, 4, 2, 2, 2])        # returns [2]
 mode([3, 4, 5, 3, 4, 2, 5, 2, 2, 4, 4, 2, 2, 2])        # returns [2]
-mode([3, 4, 5, 3, 4, 2, 5, 2, 2, 4, 4, 4, 2, 2, 4, 2])  # returns [2, 4]
+mode([3, 4, 5, 3, 4, 2, 5, 2, 2, 4, 4, 4, 2, 2, 4, 2])  # returns [4, 2]
 mode(["x", "y", "y", "z"])                              # returns ["y"]
 mode(["x", "x" , "y", "y", "z"])                       # returns ["x", "y"]
 ```
 
+The modes are listed in the order in which they reached their count. Each
+value is hashed once, to find its slot in a vector of counts. For streams too
+large to count exactly, see `HeavyHitters`.
+
 Contributed By:- [Ashwani Rathee](https://github.com/ashwani-rathee)
 """
 function mode(nums)
-    dict = Dict() # nums => Number of repetitions
-    result = [] # Array of the modes so far
+    T = eltype(nums)
+    return find_modes!(T[], Dict{T,Int}(), Int[], nums)
+end
+
+"""
+    mode!(ws::Workspace, nums)
+
+Same modes as `mode(nums)`, in a vector of the workspace `ws`, which also holds
+the counts: nothing is allocated once they have grown to the number of distinct
+values.
+"""
+function mode!(ws::Workspace, nums)
+    T = eltype(nums)
+    return find_modes!(acquire!(ws, Vector{T}), acquire!(ws, Dict{T,Int}), acquire!(ws, Vector{Int}), nums)
+end
+
+# result: Array of the modes so far
+# slots: nums => index of its number of repetitions in counts
+function find_modes!(result::Vector, slots::Dict, counts::Vector{Int}, nums)
     max = 0 # Max of repetitions so far
 
     for i in nums
-        # Add one to the dict[i] entry (create one if none)
-        if i in keys(dict)
-            dict[i] += 1
-        else
-            dict[i] = 1
-        end
+        # Add one to the count of i (create one if none)
+        slot = get!(slots, i, length(counts) + 1)
+        slot > length(counts) && push!(counts, 0)
+        c = counts[slot] += 1
         # Result updated if no of repetitions of i >= max
-        if dict[i] >= max
-            if dict[i] > max
+        if c >= max
+            if c > max
                 empty!(result)
-                max += 1
+                max = c
             end
-            append!(result, [i])
+            push!(result, i)
         end
     end
 
@@ -0,0 +1,189 @@
+"""
+    surfarea_cube!(out, side)
+    surfarea_sphere!(out, radius)
+    area_rectangle!(out, length, width)
+    area_square!(out, side)
+    area_triangle!(out, base, height)
+    area_heron_triangle!(out, side1, side2, side3)
+    area_parallelogram!(out, base, height)
+    area_trapezium!(out, base1, base2, height)
+    area_circle!(out, radius)
+    area_ellipse!(out, radius_x, radius_y)
+    area_rhombus!(out, diagonal_1, diagonal_2)
+
+Areas of many shapes, given as a struct of arrays: `out[i]` is the area of the
+shape of dimensions `length[i]` and `width[i]`, and so on, as computed by the
+scalar function. All take an `ntasks` keyword, `Threads.nthreads()` by default.
+
+The dimensions are validated while the areas are computed, by an `@simd` loop
+without branches, and a `DomainError` is thrown after it if any shape is
+invalid, `out` then holding unspecified values.
+
+# Example
+
+```julia
+a, b, c = [3.0, 5.0], [4.0, 12.0], [5.0, 13.0]
+area_heron_triangle!(similar(a), a, b, c)   # returns [6.0, 30.0]
+area_circle!(zeros(3), [1.0, 2.0, -1.0])    # throws DomainError
+```
+"""
+function surfarea_cube! end
+
+# the dimensions are valid if none is negative, as for the scalar functions
+nonnegative(x::Real...) = !reduce(|, map(<(0), x))
+
+for (f, area) in (
+    (:surfarea_cube!, :(side -> 6(side^2))),
+    (:surfarea_sphere!, :(radius -> oftype(float(radius), 4π) * (radius^2))),
+    (:area_square!, :(side -> side^2)),
+    (:area_circle!, :(radius -> oftype(float(radius), π) * radius^2)),
+)
+    @eval function $f(out::AbstractVector, x::AbstractVector; ntasks::Integer = Threads.nthreads())
+        return map_area!($area, nonnegative, $(string(f)), out, (x,), ntasks)
+    end
+end
+
+for (f, area) in (
+    (:area_rectangle!, :((length, width) -> length * width)),
+    (:area_triangle!, :((base, height) -> (base * height) / 2)),
+    (:area_parallelogram!, :((base, height) -> base * height)),
+    (:area_ellipse!, :((x, y) -> oftype(float(x), π) * x * y)),
+    (:area_rhombus!, :((d1, d2) -> d1 * d2 / 2)),
+)
+    @eval function $f(out::AbstractVector, x::AbstractVector, y::AbstractVector; ntasks::Integer = Threads.nthreads())
+        return map_area!($area, nonnegative, $(string(f)), out, (x, y), ntasks)
+    end
+end
+
+function area_trapezium!(out::AbstractVector, base1::AbstractVector, base2::AbstractVector, height::AbstractVector;
+        ntasks::Integer = Threads.nthreads())
+    return map_area!((b1, b2, h) -> (b1 + b2) * h / 2, nonnegative, "area_trapezium!", out, (base1, base2, height), ntasks)
+end
+
+function area_heron_triangle!(out::AbstractVector, side1::AbstractVector, side2::AbstractVector, side3::AbstractVector;
+        ntasks::Integer = Threads.nthreads())
+    return map_area!(heron, is_triangle, "area_heron_triangle!", out, (side1, side2, side3), ntasks)
+end
+
+is_triangle(a, b, c) = nonnegative(a, b, c) & !((a + b < c) | (a + c < b) | (b + c < a))
+
+# Heron's formula as in area_heron_triangle, but computing the square root of
+# a rounding error below 0 as 0, invalid triangles being reported after the loop
+@inline function heron(a, b, c)
+    s = (a + b + c) / 2
+    return sqrt(max(zero(s), s * (s - a) * (s - b) * (s - c)))
+end
+
+function map_area!(area, valid, name, out::AbstractVector, args::Tuple, ntasks::Integer)
+    all(x -> axes(x) == axes(out), args) ||
+        throw(DimensionMismatch("$(length(out)) outputs for $(join(map(length, args), ", ")) dimensions"))
+    n = length(out)
+    # tasks get 2^16 shapes at least
+    ntasks = clamp(ntasks, 1, max(1, n >> 16))
+    bounds = [firstindex(out) + (n * t) ÷ ntasks for t in 0:ntasks]
+    valid_chunks = Vector{Bool}(undef, ntasks)
+    if ntasks == 1
+        valid_chunks[1] = area_chunk!(area, valid, out, args, bounds[1], bounds[2] - 1)
+    else
+        @sync for t in 1:ntasks
+            Threads.@spawn valid_chunks[t] = area_chunk!(area, valid, out, args, bounds[t], bounds[t+1] - 1)
+        end
+    end
+    all(valid_chunks) || throw(DomainError("$name() only accepts valid, non-negative dimensions"))
+    return out
+end
+
+# out[i] = area(x[i]...) for i in first:last, and whether all the x[i] are valid
+function area_chunk!(area, valid, out, args::Tuple{Any}, first, last)
+    x, = args
+    ok = true
+    @inbounds @simd for i in first:last
+        ok &= valid(x[i])
+        out[i] = area(x[i])
+    end
+    return ok
+end
+
+function area_chunk!(area, valid, out, args::Tuple{Any,Any}, first, last)
+    x, y = args
+    ok = true
+    @inbounds @simd for i in first:last
+        ok &= valid(x[i], y[i])
+        out[i] = area(x[i], y[i])
+    end
+    return ok
+end
+
+function area_chunk!(area, valid, out, args::Tuple{Any,Any,Any}, first, last)
+    x, y, z = args
+    ok = true
+    @inbounds @simd for i in first:last
+        ok &= valid(x[i], y[i], z[i])
+        out[i] = area(x[i], y[i], z[i])
+    end
+    return ok
+end
+
+"""
+    area_polygon(x, y)
+    area_polygon!(out, x, y, offsets)
+
+Area of the simple polygon of vertices `(x[i], y[i])`, in either order, by the
+shoelace formula. The coordinates are taken relative to the first vertex,
+which keeps the products small for polygons far from the origin.
+
+`area_polygon!` computes the areas of many polygons stored one after the other
+in `x` and `y`, the vertices of polygon `k` being at `offsets[k]:offsets[k+1]-1`,
+in `ntasks` tasks.
+
+# Example
+
+```julia
+area_polygon([0, 4, 4, 0], [0, 0, 3, 3])    # returns 12.0
+x, y = [0.0, 1, 0, 0, 2, 2, 0], [0.0, 0, 1, 0, 0, 2, 2]
+area_polygon!(zeros(2), x, y, [1, 4, 8])    # returns [0.5, 4.0]
+```
+
+# Reference
+- https://en.wikipedia.org/wiki/Shoelace_formula
+"""
+function area_polygon(x::AbstractVector, y::AbstractVector)
+    length(x) == length(y) || throw(DimensionMismatch("$(length(x)) x and $(length(y)) y coordinates"))
+    Base.require_one_based_indexing(x, y)
+    return shoelace(x, y, 1, length(x))
+end
+
+function area_polygon!(out::AbstractVector, x::AbstractVector, y::AbstractVector, offsets::AbstractVector{<:Integer};
+        ntasks::Integer = Threads.nthreads())
+    n = length(out)
+    length(x) == length(y) || throw(DimensionMismatch("$(length(x)) x and $(length(y)) y coordinates"))
+    length(offsets) == n + 1 || throw(DimensionMismatch("$n outputs for $(length(offsets) - 1) polygons"))
+    Base.require_one_based_indexing(out, x, y, offsets)
+    for k in 1:n
+        1 <= offsets[k] <= offsets[k + 1] <= length(x) + 1 ||
+            throw(ArgumentError("the offsets must be sorted, from 1 to $(length(x) + 1)"))
+    end
+    # tasks get 2^16 vertices at least
+    ntasks = clamp(ntasks, 1, max(1, min(n, length(x) >> 16)))
+    bounds = [1 + (n * t) ÷ ntasks for t in 0:ntasks]
+    @sync for t in 1:ntasks
+        Threads.@spawn for k in bounds[t]:bounds[t+1]-1
+            @inbounds out[k] = shoelace(x, y, offsets[k], offsets[k + 1] - 1)
+        end
+    end
+    return out
+end
+
+# Area of the polygon of vertices first:last
+function shoelace(x, y, first, last)
+    s = zero(float(eltype(x))) * zero(float(eltype(y)))
+    last - first < 2 && return s
+    @inbounds begin
+        x0, y0 = x[first], y[first]
+        # the terms of the first vertex are 0
+        @simd for i in first+1:last-1
+            s += (x[i] - x0) * (y[i + 1] - y0) - (x[i + 1] - x0) * (y[i] - y0)
+        end
+    end
+    return abs(s) / 2
+end
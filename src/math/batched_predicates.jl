@@ -0,0 +1,48 @@
+"""
+    map_predicate(f, xs; ntasks=Threads.nthreads())
+
+`BitVector` of `f(x)` for all the values `x` of `xs`, like `f.(xs)`, computed in
+`ntasks` tasks which fill whole 64-bit chunks of it, a word at a time.
+
+It is the batch version of `is_armstrong`, `perfect_cube`, `perfect_square` and
+the other predicates; `perfect_numbers` does the same for `perfect_number` over
+a range. Broadcasting them, e.g. `perfect_square.(xs)`, stays a plain broadcast.
+
+# Example
+
+```julia
+findall(map_predicate(perfect_square, 1:50))        # returns [1, 4, 9, 16, 25, 36, 49]
+map_predicate(is_armstrong, 1:10^6; ntasks = 4)      # same values as is_armstrong.(1:10^6)
+```
+"""
+function map_predicate(f, xs::AbstractVector; ntasks::Integer = Threads.nthreads())
+    out = falses(length(xs))
+    nchunks = length(out.chunks)
+    # tasks get 16 chunks (1024 values) at least
+    ntasks = clamp(ntasks, 1, max(1, nchunks ÷ 16))
+    if ntasks == 1
+        fill_predicate!(f, out, xs, 1, nchunks)
+    else
+        bounds = [1 + (nchunks * t) ÷ ntasks for t in 0:ntasks]
+        @sync for t in 1:ntasks
+            Threads.@spawn fill_predicate!(f, out, xs, bounds[t], bounds[t+1] - 1)
+        end
+    end
+    return out
+end
+
+# Chunks first:last of out, each one from 64 values of xs
+function fill_predicate!(f, out::BitVector, xs::AbstractVector, first::Int, last::Int)
+    chunks = out.chunks
+    offset = firstindex(xs) - 1
+    n = length(xs)
+    @inbounds for c in first:last
+        base = 64 * (c - 1)
+        word = zero(UInt64)
+        for j in 1:min(64, n - base)
+            word |= UInt64(f(xs[offset + base + j])::Bool) << (j - 1)
+        end
+        chunks[c] = word
+    end
+    return out
+end
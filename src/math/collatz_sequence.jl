@@ -6,6 +6,10 @@ obtained as follows:
 	If n term is even, the next term is: n / 2 .
 	If n is odd, the next term is: 3 * n + 1.
 The conjecture states the sequence will always reach 1 for any starting value n.
+
+For an integer `n` it is `collect(CollatzSequence(n))`: iterate over
+`CollatzSequence(n)` to go through the terms without storing them, and use
+`collatz_stopping_times` for the number of steps only.
 """
 
 function collatz_sequence(n)
@@ -16,3 +20,132 @@ function collatz_sequence(n)
 	end
 	return sequence
 end
+
+collatz_sequence(n::Integer) = collect(CollatzSequence(n))
+
+"""
+    collatz_sequence!(ws::Workspace, n::Integer)
+
+Same sequence as `collatz_sequence(n)`, in a vector of the workspace `ws`,
+which allocates nothing once it has grown to the length of the sequence.
+"""
+collatz_sequence!(ws::Workspace, n::Integer) = append!(acquire!(ws, Vector{typeof(n)}), CollatzSequence(n))
+
+"""
+    CollatzSequence(n)
+
+Iterator over the terms of the Collatz sequence from the positive integer `n`
+down to 1, which allocates nothing. Throws an `OverflowError` if `3n + 1` does
+not fit in the type of `n` (use a `BigInt` then).
+
+# Example
+
+```julia
+for term in CollatzSequence(3)
+	print(term, " ")      # prints 3 10 5 16 8 4 2 1
+end
+maximum(CollatzSequence(27))  # returns 9232
+```
+"""
+struct CollatzSequence{T<:Integer}
+	start::T
+	function CollatzSequence(n::T) where T<:Integer
+		n >= 1 || throw(DomainError(n, "the Collatz sequence starts at a positive integer"))
+		return new{T}(n)
+	end
+end
+
+Base.IteratorSize(::Type{<:CollatzSequence}) = Base.SizeUnknown()
+Base.eltype(::Type{CollatzSequence{T}}) where T = T
+
+# The state is the next term, 0 after 1
+function Base.iterate(s::CollatzSequence, n = s.start)
+	n == 0 && return nothing
+	return n, n == 1 ? zero(n) : collatz_step(n)
+end
+
+@inline function collatz_step(n::Base.BitInteger)
+	iseven(n) && return n >> 1
+	n > (typemax(n) - one(n)) ÷ 3 && throw(OverflowError("3n + 1 overflows $(typeof(n)) for n = $n"))
+	return 3n + one(n)
+end
+
+collatz_step(n::Integer) = iseven(n) ? n >> 1 : 3n + one(n)
+
+# Starting values below which the stopping times are looked up by default
+const COLLATZ_MEMO_LIMIT = 1 << 20
+
+"""
+    collatz_stopping_times(starts; memo_limit=2^20, ntasks=Threads.nthreads())
+    collatz_stopping_times!(out, starts; memo_limit=2^20, ntasks=Threads.nthreads())
+
+Number of steps from each starting value of `starts` (e.g. a range) down to 1,
+`length(collatz_sequence(n)) - 1`, without building the sequences.
+
+The stopping times of the values up to `memo_limit` are computed first, each
+one by walking down to a smaller value whose time is already known. The table
+(4 bytes per value) is then shared by `ntasks` tasks, each one with a slice of
+`starts`, which only walk until the values fall below `memo_limit`.
+
+# Example
+
+```julia
+collatz_stopping_times(1:10)   # returns [0, 1, 7, 2, 5, 8, 16, 3, 19, 6]
+argmax(collatz_stopping_times(1:10^6))  # returns 837799
+```
+"""
+function collatz_stopping_times(starts::AbstractVector{<:Integer}; memo_limit::Integer = COLLATZ_MEMO_LIMIT,
+		ntasks::Integer = Threads.nthreads())
+	out = Vector{Int}(undef, length(starts))
+	return collatz_stopping_times!(out, starts; memo_limit = memo_limit, ntasks = ntasks)
+end
+
+function collatz_stopping_times!(out::AbstractVector{<:Integer}, starts::AbstractVector{<:Integer};
+		memo_limit::Integer = COLLATZ_MEMO_LIMIT, ntasks::Integer = Threads.nthreads())
+	length(out) == length(starts) || throw(DimensionMismatch("out has $(length(out)) elements, starts $(length(starts))"))
+	Base.require_one_based_indexing(out, starts)
+	n = length(starts)
+	n == 0 && return out
+	lo, hi = extrema(starts)
+	lo >= 1 || throw(DomainError(lo, "the Collatz sequence starts at a positive integer"))
+	memo = collatz_memo(Int(clamp(hi, 1, max(memo_limit, 1))))
+	# tasks get 1024 starting values at least
+	ntasks = clamp(ntasks, 1, max(1, n ÷ 1024))
+	if ntasks == 1
+		collatz_chunk!(out, starts, memo, 1, n)
+	else
+		bounds = [1 + (n * t) ÷ ntasks for t in 0:ntasks]
+		@sync for t in 1:ntasks
+			Threads.@spawn collatz_chunk!(out, starts, memo, bounds[t], bounds[t+1] - 1)
+		end
+	end
+	return out
+end
+
+# memo[n] is the stopping time of n, for n in 1:limit
+function collatz_memo(limit::Int)
+	memo = Vector{Int32}(undef, limit)
+	memo[1] = 0
+	for n in 2:limit
+		x, steps = n, 0
+		while x >= n
+			x = collatz_step(x)
+			steps += 1
+		end
+		@inbounds memo[n] = steps + memo[x]
+	end
+	return memo
+end
+
+function collatz_chunk!(out, starts, memo::Vector{Int32}, first::Int, last::Int)
+	limit = length(memo)
+	@inbounds for i in first:last
+		x, steps = starts[i], 0
+		while x > limit
+			x = collatz_step(x)
+			steps += 1
+		end
+		out[i] = steps + memo[x]
+	end
+	return out
+end
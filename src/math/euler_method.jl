@@ -2,17 +2,24 @@
     euler_method(f, x0, span, h=1.0e-2)
 
 Calculate the solution to a differential equation using forward euler method.
+
+Returns the values `x` and the times `t`, from `t[1] = span[1]` to
+`t[end] = span[2]` by steps of `h`, the last one shorter if needed, with
+`x[i + 1] = x[i] + h * f(x[i], t[i])`. `x0` may be a number or, if `f`
+returns vectors, a vector. `solve_ode!` has in-place and higher order
+integrators.
 """
 function euler_method(f, x0, span, h=1.0e-2)
     s, e = span
-    steps = floor((e - s) / h) |> Int
-    x = Vector{Float64}(undef, steps)
-	t = Vector{Float64}(undef, steps)
+    # steps of h, but a step shorter than h / 10^8 which is only a rounding error
+    steps = max(0, ceil(Int, (e - s) / h - 1.0e-8))
+    x = Vector{typeof(x0 + h * f(x0, s))}(undef, steps + 1)
+    t = Vector{typeof(s + h)}(undef, steps + 1)
     x[1] = x0
-	t[1] = 0
-    for i in 1:(steps - 1)
-        x[i + 1] = x[i] + h * f(x[i], t[i])
-		t[i + 1] = t[i] + h
+    t[1] = s
+    for i in 1:steps
+        t[i + 1] = i == steps ? e : s + i * h
+        x[i + 1] = x[i] + (t[i + 1] - t[i]) * f(x[i], t[i])
     end
     return x, t
 end
@@ -19,7 +19,9 @@ function factorial_iterative(n)
         throw(error("factorial_iterative() only accepts non-negative integral values"))
     end
     factorial::BigInt = 1
-    map(i -> factorial *= i, 1:n)
+    for i in 1:n
+        factorial *= i
+    end
     return factorial
 end
 
@@ -50,3 +52,92 @@ function factorial_recursive(n)
         return factorial
     end
 end
+
+"""
+    factorial_fast(n; ntasks=Threads.nthreads())
+    factorial_fast(T, n)
+
+Factorial of `n` as a `BigInt`, or as the machine integer type `T` (an
+`OverflowError` is thrown if it does not fit, e.g. beyond 20! for `Int64`).
+
+Up to `34!` it is looked up in a table. Beyond, the powers of two are taken out
+(`n!` has `n - count_ones(n)` of them, by Legendre's formula) and put back with a
+shift at the end. The odd parts of `3, ..., n` are multiplied together in
+`UInt64` words as long as they fit, then the words are multiplied with a
+balanced product tree, so that GMP multiplies numbers of similar sizes, the
+larger ones with its subquadratic algorithms. The branches of the top `log2(ntasks)`
+levels of the tree are computed in separate tasks.
+
+`factorial_iterative` and `factorial_recursive` are the reference implementations.
+
+# Example
+```julia
+factorial_fast(5)           # returns 120
+factorial_fast(Int64, 20)   # returns 2432902008176640000
+ndigits(factorial_fast(10^6))  # returns 5565709
+```
+"""
+function factorial_fast(n::Integer; ntasks::Integer = Threads.nthreads())
+    n < 0 && throw(DomainError(n, "factorial_fast() only accepts non-negative integral values"))
+    n < length(FACTORIAL_TABLE) && return BigInt(FACTORIAL_TABLE[n + 1])
+    n = Int(n)
+    words = odd_part_words(n)
+    return product_tree(words, 1, length(words), ntasks) << (n - count_ones(n))
+end
+
+function factorial_fast(n::Real; ntasks::Integer = Threads.nthreads())
+    if n != trunc(n) || n < 0
+        throw(DomainError(n, "factorial_fast() only accepts non-negative integral values"))
+    end
+    return factorial_fast(Integer(n); ntasks = ntasks)
+end
+
+function factorial_fast(::Type{T}, n::Integer) where T <: Base.BitInteger
+    n < 0 && throw(DomainError(n, "factorial_fast() only accepts non-negative integral values"))
+    if n >= length(FACTORIAL_TABLE) || FACTORIAL_TABLE[n + 1] > typemax(T)
+        throw(OverflowError("$n! does not fit in $T"))
+    end
+    return T(FACTORIAL_TABLE[n + 1])
+end
+
+# 0!, 1!, ..., 34!, the largest one that fits in 128 bits
+const FACTORIAL_TABLE = Tuple(UInt128(factorial(big(i))) for i in 0:34)
+
+# Products of the odd parts of 3, ..., n, packed in words as long as they fit
+function odd_part_words(n::Int)
+    words = UInt64[]
+    word = one(UInt64)
+    for i in 3:n
+        m = UInt64(i >> trailing_zeros(i))
+        # the product of a and b has at most as many bits as a and b together
+        if leading_zeros(word) + leading_zeros(m) < 64
+            push!(words, word)
+            word = m
+        else
+            word *= m
+        end
+    end
+    push!(words, word)
+    return words
+end
+
+# Words multiplied one after the other in the leaves of the product tree
+const PRODUCT_LEAF = 32
+
+# Product of words[lo:hi], the halves in separate tasks while ntasks > 1
+function product_tree(words::Vector{UInt64}, lo::Int, hi::Int, ntasks::Integer)
+    if hi - lo < PRODUCT_LEAF
+        product = BigInt(words[lo])
+        for i in lo+1:hi
+            product *= words[i]
+        end
+        return product
+    end
+    mid = (lo + hi) >>> 1
+    if ntasks > 1
+        left = Threads.@spawn product_tree(words, lo, mid, cld(ntasks, 2))
+        right = product_tree(words, mid + 1, hi, ntasks ÷ 2)
+        return fetch(left)::BigInt * right
+    end
+    return product_tree(words, lo, mid, 1) * product_tree(words, mid + 1, hi, 1)
+end
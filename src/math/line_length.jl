@@ -26,3 +26,26 @@ function line_length(f, x_start, x_end, steps=100)
 
 	return len
 end
+
+"""
+    line_length(x, y)
+
+Length of the polyline through the points `(x[i], y[i])`, such as a curve
+sampled at the points `x`, in a single `@simd` loop.
+
+# Example
+
+```julia
+x = range(0, π, length = 101)
+line_length(x, sin.(x))   # same as line_length(sin, 0, π, 100)
+```
+"""
+function line_length(x::AbstractVector, y::AbstractVector)
+	length(x) == length(y) || throw(DimensionMismatch("$(length(x)) x and $(length(y)) y coordinates"))
+	Base.require_one_based_indexing(x, y)
+	len = zero(float(eltype(x))) * zero(float(eltype(y)))
+	@inbounds @simd for i in 1:length(x)-1
+		len += sqrt((x[i + 1] - x[i])^2 + (y[i + 1] - y[i])^2)
+	end
+	return len
+end
@@ -0,0 +1,351 @@
+"""
+    ForwardEuler(h)
+    RungeKutta4(h)
+    DormandPrince(; abstol=1.0e-6, reltol=1.0e-3, h0=0.0, hmin=0.0)
+
+Methods for `solve_ode!`: the forward Euler method and the classical
+Runge-Kutta method of order 4, with steps of `h`, and the Dormand-Prince
+method of order 5 with adaptive steps. The error estimated by its embedded
+method of order 4 is kept below `abstol + reltol * abs(u)` (in root mean
+square over the components of `u`); the first step is `h0`, chosen from the
+span if 0, and an error is thrown if the steps get smaller than `hmin`.
+
+# Reference
+- Hairer, Nørsett & Wanner, Solving Ordinary Differential Equations I (1993), II.5 and II.6
+"""
+abstract type ODEMethod end
+
+struct ForwardEuler{T<:Real} <: ODEMethod
+    h::T
+end
+
+struct RungeKutta4{T<:Real} <: ODEMethod
+    h::T
+end
+
+struct DormandPrince <: ODEMethod
+    abstol::Float64
+    reltol::Float64
+    h0::Float64
+    hmin::Float64
+end
+
+DormandPrince(; abstol::Real = 1.0e-6, reltol::Real = 1.0e-3, h0::Real = 0.0, hmin::Real = 0.0) =
+    DormandPrince(abstol, reltol, h0, hmin)
+
+"""
+    ODECache(u0)
+    ode_cache(u0)
+
+Buffers for the stages of `solve_ode!` with a mutable state like `u0`, to be
+reused between solutions. `ode_cache` returns `nothing` for numbers and
+`SVector`s, which need no buffer.
+"""
+struct ODECache{V<:AbstractVector}
+    u::V            # current state
+    unew::V         # state after the step being tried
+    tmp::V          # state at which a stage is evaluated
+    k::NTuple{7,V}  # derivatives of the stages
+end
+
+function ODECache(u0::AbstractVector)
+    buffer() = similar(u0, float(eltype(u0)))
+    return ODECache(buffer(), buffer(), buffer(), ntuple(_ -> buffer(), 7))
+end
+
+ode_cache(u0) = nothing
+ode_cache(u0::AbstractVector) = ODECache(u0)
+ode_cache(u0::SVector) = nothing
+
+# The derivative of the stage i at (u, t), written to the cache for mutable states
+@inline stage!(c::ODECache, i, f, u, p, t) = (f(c.k[i], u, p, t); c.k[i])
+@inline stage!(::Nothing, i, f, u, p, t) = f(u, p, t)
+
+# u + h * sum(a .* k), written to out for mutable states
+@inline function combine!(out::AbstractVector, u, h, a::NTuple{N,Float64}, k::NTuple{N}) where N
+    @inbounds for j in eachindex(out)
+        s = zero(eltype(out))
+        for m in 1:N
+            s += a[m] * k[m][j]
+        end
+        out[j] = u[j] + h * s
+    end
+    return out
+end
+@inline combine!(::Nothing, u, h, a::NTuple{N,Float64}, k::NTuple{N}) where N = u + h * sum(a .* k)
+
+scratch(c::ODECache) = c.tmp
+scratch(::Nothing) = nothing
+inplace(c::ODECache, u) = u
+inplace(::Nothing, u) = nothing
+
+function ode_step(::ForwardEuler, c, f, u, p, t, h)
+    k1 = stage!(c, 1, f, u, p, t)
+    return combine!(inplace(c, u), u, h, (1.0,), (k1,))
+end
+
+function ode_step(::RungeKutta4, c, f, u, p, t, h)
+    k1 = stage!(c, 1, f, u, p, t)
+    k2 = stage!(c, 2, f, combine!(scratch(c), u, h, (0.5,), (k1,)), p, t + h / 2)
+    k3 = stage!(c, 3, f, combine!(scratch(c), u, h, (0.5,), (k2,)), p, t + h / 2)
+    k4 = stage!(c, 4, f, combine!(scratch(c), u, h, (1.0,), (k3,)), p, t + h)
+    return combine!(inplace(c, u), u, h, (1 / 6, 1 / 3, 1 / 3, 1 / 6), (k1, k2, k3, k4))
+end
+
+# Dormand-Prince tableau, the last row being the weights of the solution
+const DP_C = (1 / 5, 3 / 10, 4 / 5, 8 / 9, 1.0, 1.0)
+const DP_A = ((1 / 5,),
+    (3 / 40, 9 / 40),
+    (44 / 45, -56 / 15, 32 / 9),
+    (19372 / 6561, -25360 / 2187, 64448 / 6561, -212 / 729),
+    (9017 / 3168, -355 / 33, 46732 / 5247, 49 / 176, -5103 / 18656),
+    (35 / 384, 0.0, 500 / 1113, 125 / 192, -2187 / 6784, 11 / 84))
+# difference between the solutions of order 5 and 4
+const DP_E = (71 / 57600, 0.0, -71 / 16695, 71 / 1920, -17253 / 339200, 22 / 525, -1 / 40)
+# dense output of order 4
+const DP_D = (-12715105075 / 11282082432, 0.0, 87487479700 / 32700410799, -10690763975 / 1880347072,
+    701980252875 / 199316789632, -1453857185 / 822651844, 69997945 / 29380423)
+
+# Step from u at t, k1 being the derivative there. Returns the new state, the
+# derivatives of the 7 stages, the last one at the new state, and the error
+# relative to the tolerances.
+function ode_step(m::DormandPrince, c, f, u, k1, p, t, h)
+    k2 = stage!(c, 2, f, combine!(scratch(c), u, h, DP_A[1], (k1,)), p, t + DP_C[1] * h)
+    k3 = stage!(c, 3, f, combine!(scratch(c), u, h, DP_A[2], (k1, k2)), p, t + DP_C[2] * h)
+    k4 = stage!(c, 4, f, combine!(scratch(c), u, h, DP_A[3], (k1, k2, k3)), p, t + DP_C[3] * h)
+    k5 = stage!(c, 5, f, combine!(scratch(c), u, h, DP_A[4], (k1, k2, k3, k4)), p, t + DP_C[4] * h)
+    k6 = stage!(c, 6, f, combine!(scratch(c), u, h, DP_A[5], (k1, k2, k3, k4, k5)), p, t + DP_C[5] * h)
+    unew = combine!(c === nothing ? nothing : c.unew, u, h, DP_A[6], (k1, k2, k3, k4, k5, k6))
+    k7 = stage!(c, 7, f, unew, p, t + h)
+    k = (k1, k2, k3, k4, k5, k6, k7)
+    return unew, k, dp_error(m, u, unew, h, k)
+end
+
+function dp_error(m::DormandPrince, u::AbstractVector, unew::AbstractVector, h, k)
+    s = zero(float(real(eltype(u))))
+    @inbounds for j in eachindex(u)
+        e = zero(eltype(u))
+        for i in 1:7
+            e += DP_E[i] * k[i][j]
+        end
+        s += abs2(h * e / (m.abstol + m.reltol * max(abs(u[j]), abs(unew[j]))))
+    end
+    return sqrt(s / length(u))
+end
+
+function dp_error(m::DormandPrince, u, unew, h, k)
+    e = h * sum(DP_E .* k)
+    return sqrt(sum(abs2, e ./ (m.abstol .+ m.reltol .* max.(abs.(u), abs.(unew)))) / length(u))
+end
+
+# State at t + θh, in the step from u to unew, written to out for mutable states
+function dense_output!(out::AbstractVector, θ, h, u, unew, k)
+    @inbounds for j in eachindex(out)
+        d = zero(eltype(out))
+        for i in 1:7
+            d += DP_D[i] * k[i][j]
+        end
+        diff = unew[j] - u[j]
+        b = h * k[1][j] - diff
+        out[j] = u[j] + θ * (diff + (1 - θ) * (b + θ * (diff - h * k[7][j] - b + (1 - θ) * h * d)))
+    end
+    return out
+end
+
+function dense_output!(::Nothing, θ, h, u, unew, k)
+    diff = unew - u
+    b = h * k[1] - diff
+    return u + θ * (diff + (1 - θ) * (b + θ * (diff - h * k[7] - b + (1 - θ) * h * sum(DP_D .* k))))
+end
+
+save!(us::AbstractMatrix, j, u) = (us[:, j] .= u)
+save!(us::AbstractVector, j, u) = (us[j] = u)
+
+"""
+    solve_ode!(us, ts, method, f, u0, tspan, p=nothing; cache=ode_cache(u0))
+    solve_ode!(callback, method, f, u0, tspan, p=nothing; every=1, cache=ode_cache(u0))
+
+Solves `u' = f(u, p, t)` with `u(tspan[1]) = u0` up to `tspan[2]` with `method`
+(`ForwardEuler`, `RungeKutta4` or `DormandPrince`), and returns the final state.
+
+A mutable vector state is updated in place by `f(du, u, p, t)`, in the buffers
+of `cache`, which can be reused for other solutions. Numbers and `SVector`s are
+returned by `f(u, p, t)`; the steps allocate nothing either way.
+
+The first form saves the states at the sorted times `ts` into the columns of
+the matrix `us`, or the elements of the vector `us` for numbers and
+`SVector`s. The fixed step methods shorten the steps just before the times of
+`ts`, `DormandPrince` interpolates them with its dense output, so that they do
+not constrain its steps. The second form calls `callback(t, u)` at the start
+and then every `every` steps; `u` is overwritten afterwards for mutable states.
+
+See also `solve_ensemble!`.
+
+# Example
+
+```julia
+decay!(du, u, p, t) = (du .= -p .* u)
+ts = 0:0.1:1
+us = zeros(2, length(ts))
+solve_ode!(us, ts, DormandPrince(reltol = 1.0e-8), decay!, [1.0, 2.0], (0.0, 1.0), [1.0, 2.0])
+us[:, end]   # close to [exp(-1), 2exp(-2)]
+
+solve_ode!(RungeKutta4(0.01), (u, p, t) -> -u, 1.0, (0.0, 1.0); every = 10) do t, u
+    println(t, " ", u)
+end
+```
+"""
+function solve_ode!(us::AbstractArray, ts::AbstractVector, method::ODEMethod, f, u0, tspan,
+        p = nothing; cache = ode_cache(u0))
+    size(us, ndims(us)) == length(ts) || throw(DimensionMismatch("$(length(ts)) times but $(size(us, ndims(us))) states"))
+    issorted(ts) || throw(ArgumentError("the times must be sorted"))
+    s, e = tspan
+    isempty(ts) || (s <= ts[1] && ts[end] <= e) || throw(ArgumentError("the times must lie in the span"))
+    return integrate(SaveAt(us, ts, Ref(firstindex(ts))), method, f, u0, s, e, p, cache, ts)
+end
+
+function solve_ode!(callback, method::ODEMethod, f, u0, tspan, p = nothing; every::Integer = 1,
+        cache = ode_cache(u0))
+    every > 0 || throw(ArgumentError("every must be positive"))
+    return integrate(SaveEvery(callback, Int(every)), method, f, u0, tspan[1], tspan[2], p, cache, nothing)
+end
+
+# Savers, called as save(t, u, n) with the state after the step n (0 at the start)
+struct SaveAt{A,V}
+    us::A
+    ts::V
+    next::Base.RefValue{Int}    # index of the next time to save
+end
+
+function (s::SaveAt)(t, u, n)
+    j = s.next[]
+    while j <= lastindex(s.ts) && s.ts[j] <= t
+        save!(s.us, j, u)
+        j += 1
+    end
+    s.next[] = j
+    return nothing
+end
+
+struct SaveEvery{F}
+    callback::F
+    every::Int
+end
+
+(s::SaveEvery)(t, u, n) = (n % s.every == 0 && s.callback(t, u); nothing)
+
+no_save(t, u, n) = nothing
+
+function initial_state(c::ODECache, u0)
+    length(u0) == length(c.u) || throw(DimensionMismatch("a cache for $(length(c.u)) components, a state of $(length(u0))"))
+    return copyto!(c.u, u0)
+end
+initial_state(::Nothing, u0) = float(u0)
+
+# Integrates from s to e, calling save after each step; the fixed step methods
+# stop at the times of stops
+function integrate(save, method::Union{ForwardEuler,RungeKutta4}, f, u0, s, e, p, cache, stops)
+    s <= e || throw(ArgumentError("the span must be increasing"))
+    method.h > 0 || throw(ArgumentError("the step must be positive"))
+    u = initial_state(cache, u0)
+    t = float(s)
+    save(t, u, 0)
+    j = stops === nothing ? 1 : firstindex(stops)
+    n = 0
+    while t < e
+        while stops !== nothing && j <= lastindex(stops) && stops[j] <= t
+            j += 1
+        end
+        stop = stops === nothing || j > lastindex(stops) ? e : min(stops[j], e)
+        # steps shorter than h / 10^8 are left to rounding
+        if t + method.h * (1 + 1.0e-8) >= stop
+            h, t_next = stop - t, float(stop)
+        else
+            h, t_next = method.h, t + method.h
+        end
+        u = ode_step(method, cache, f, u, p, t, h)
+        t = t_next
+        n += 1
+        save(t, u, n)
+    end
+    return u
+end
+
+function integrate(save, m::DormandPrince, f, u0, s, e, p, cache, stops)
+    s <= e || throw(ArgumentError("the span must be increasing"))
+    u = initial_state(cache, u0)
+    t = float(s)
+    k1 = stage!(cache, 1, f, u, p, t)
+    save(t, u, 0)
+    h = m.h0 > 0 ? m.h0 : (e - s) / 100
+    n = 0
+    while t < e
+        h = min(h, e - t)
+        h > m.hmin || error("DormandPrince: step size $h too small at t = $t")
+        unew, k, err = ode_step(m, cache, f, u, k1, p, t, h)
+        if err <= 1
+            n += 1
+            if stops !== nothing
+                # the states at the times of stops in (t, t + h]
+                for j in searchsortedlast(stops, t)+1:lastindex(stops)
+                    stops[j] <= t + h || break
+                    save(stops[j], dense_output!(scratch(cache), (stops[j] - t) / h, h, u, unew, k), n)
+                end
+            end
+            t = h == e - t ? float(e) : t + h
+            if cache === nothing
+                u, k1 = unew, k[7]
+            else
+                copyto!(u, unew)
+                copyto!(k1, k[7])
+            end
+            stops === nothing && save(t, u, n)
+        end
+        # step size controller, with a safety factor of 0.9 and limited changes
+        h *= clamp(0.9 * err^(-1 / 5), 0.2, 10.0)
+    end
+    return u
+end
+
+"""
+    solve_ensemble!(us, method, f, u0, tspan, ps; ntasks=Threads.nthreads())
+
+Solves `u' = f(u, ps[i], t)` from `u0` (or `u0[i]`, if `u0` is a vector of
+states) for every parameter set of `ps`, as `solve_ode!`, and saves the final
+state of the solution `i` in the column, or element, `i` of `us`. The
+parameter sets are shared out between `ntasks` tasks, each one reusing a single
+cache, so that nothing is allocated per solution.
+
+# Example
+
+```julia
+using StaticArrays
+ps = [SVector(b / 10^6, 0.3) for b in range(0.1, 1.0, length = 10^5)]
+us = Vector{SVector{3,Float64}}(undef, length(ps))
+solve_ensemble!(us, DormandPrince(), SIR, SVector(10.0^6, 10.0, 0.0), (0.0, 140.0), ps)
+maximum(u -> u[3], us)     # largest number of recovered after 140 days
+```
+"""
+function solve_ensemble!(us::AbstractArray, method::ODEMethod, f, u0, tspan, ps::AbstractVector;
+        ntasks::Integer = Threads.nthreads())
+    n = length(ps)
+    size(us, ndims(us)) == n || throw(DimensionMismatch("$n parameter sets but $(size(us, ndims(us))) states"))
+    Base.require_one_based_indexing(ps)
+    many = u0 isa AbstractVector && !isempty(u0) && !(first(u0) isa Number)
+    many && length(u0) != n && throw(DimensionMismatch("$n parameter sets but $(length(u0)) initial states"))
+    # tasks get 16 solutions at least
+    ntasks = clamp(ntasks, 1, max(1, n ÷ 16))
+    bounds = [1 + (n * t) ÷ ntasks for t in 0:ntasks]
+    @sync for t in 1:ntasks
+        Threads.@spawn solve_chunk!(us, method, f, u0, many, tspan, ps, bounds[t], bounds[t+1] - 1)
+    end
+    return us
+end
+
+function solve_chunk!(us, method, f, u0, many, tspan, ps, first, last)
+    cache = ode_cache(many ? u0[1] : u0)
+    for i in first:last
+        save!(us, i, integrate(no_save, method, f, many ? u0[i] : u0, tspan[1], tspan[2], ps[i], cache, nothing))
+    end
+    return us
+end
@@ -7,11 +7,44 @@ Check if a number is a perfect cube or not.
 ```jula
 perfect_cube(27) # returns true
 perfect_cube(4)  # returns false
+perfect_cube(-8) # returns true
 ```
 
+Integers are checked with the integer cube root `icbrt`, without floating point.
+
 Contributed By:- [Ashwani Rathee](https://github.com/ashwani-rathee)
 """
 function perfect_cube(number)
     val = number^(1/3)
     return (val * val * val) == number
 end
+
+function perfect_cube(number::Integer)
+    magnitude = abs_magnitude(number)
+    root = icbrt(magnitude)
+    return root * root * root == magnitude
+end
+
+# |number|, unsigned for machine integers so that typemin does not overflow
+abs_magnitude(number::Base.BitSigned) = unsigned(abs(number))
+abs_magnitude(number::Integer) = abs(number)
+
+"""
+    icbrt(n::Integer)
+
+Integer cube root of `n >= 0`, the largest `x` with `x^3 <= n`.
+
+Newton's iteration `x = (2x + n ÷ x^2) ÷ 3` on integers decreases towards it from
+any start above it, and stops as soon as it would increase again. The start is
+2 to the power `⌈bits/3⌉`, so that `x^2` does not overflow.
+"""
+function icbrt(n::Integer)
+    n < 0 && throw(DomainError(n, "icbrt() needs a non negative number"))
+    n < 2 && return n
+    x = one(n) << cld(ndigits(n, base = 2), 3)
+    while true
+        y = (2x + n ÷ (x * x)) ÷ 3
+        y >= x && return x
+        x = y
+    end
+end
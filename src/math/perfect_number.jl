@@ -26,14 +26,95 @@ perfect_number(8128)   # returns true
 perfect_number(123)    # returns false
 ```
 
+The sum of the divisors is computed from the prime factorization
+`n = p1^k1 * ... * pm^km` as `σ(n) = (1 + p1 + ... + p1^k1) * ... * (1 + pm + ... + pm^km)`,
+in a wider type so that it cannot overflow. For a whole range, e.g.
+`1:10^8`, `perfect_numbers` is much faster.
+
 Contributed By:- [Ashwani Rathee](https://github.com/ashwani-rathee)
 """
-function perfect_number(number)
-    divisors = []
-    for i = 1:(number÷2+1)
-        if number % i == 0
-            push!(divisors, i)
+function perfect_number(number::Integer)
+    number < 2 && return false
+    W = widen(typeof(number))
+    σ = one(W)
+    factors = prime_factors(number)
+    i = 1
+    while i <= length(factors)
+        p = W(factors[i])
+        term = total = one(W)
+        while i <= length(factors) && factors[i] == p
+            term *= p
+            total += term
+            i += 1
+        end
+        σ *= total
+    end
+    return σ == 2 * W(number)
+end
+
+perfect_number(number::Real) = isinteger(number) && perfect_number(BigInt(number))
+
+# Numbers whose divisors are summed at a time by perfect_numbers, a multiple of 64
+const DIVISOR_SEGMENT = 1 << 15
+
+"""
+    perfect_numbers(r::AbstractUnitRange; ntasks=Threads.nthreads())
+
+`BitVector` telling which numbers of `r` are perfect numbers, the same as
+`perfect_number.(r)`.
+
+The divisor sums of the numbers in `r` are sieved one segment of
+`DIVISOR_SEGMENT` numbers at a time: every `d <= √last(r)` adds `d + m ÷ d` to
+its multiples `m >= d^2` in the segment, which takes about `log(√last(r))`
+additions per number and no division. The segments are shared out between
+`ntasks` tasks.
+
+# Example
+
+```julia
+findall(perfect_numbers(1:10^4))   # returns [6, 28, 496, 8128]
+```
+"""
+function perfect_numbers(r::AbstractUnitRange{<:Integer}; ntasks::Integer = Threads.nthreads())
+    n = length(r)
+    out = falses(n)
+    n == 0 && return out
+    last(r) <= typemax(Int) || throw(ArgumentError("perfect_numbers() needs a range of Int values"))
+    lo = Int(first(r))
+    nsegments = cld(n, DIVISOR_SEGMENT)
+    ntasks = clamp(ntasks, 1, nsegments)
+    # the segments have a multiple of 64 numbers, so the tasks write different chunks of out
+    bounds = [1 + (nsegments * t) ÷ ntasks for t in 0:ntasks]
+    if ntasks == 1
+        sieve_divisor_sums!(out, lo, 1, nsegments)
+    else
+        @sync for t in 1:ntasks
+            Threads.@spawn sieve_divisor_sums!(out, lo, bounds[t], bounds[t+1] - 1)
+        end
+    end
+    return out
+end
+
+# Marks the perfect numbers of the segments first:last, out[i] is the number lo + i - 1
+function sieve_divisor_sums!(out::BitVector, lo::Int, first::Int, last::Int)
+    sums = Vector{Int}(undef, DIVISOR_SEGMENT)
+    for segment in first:last
+        i0 = 1 + DIVISOR_SEGMENT * (segment - 1)
+        i1 = min(i0 + DIVISOR_SEGMENT - 1, length(out))
+        a, b = max(lo + i0 - 1, 2), lo + i1 - 1
+        a > b && continue
+        fill!(sums, 0)
+        @inbounds for d in 1:isqrt(b)
+            # first multiple m = q * d of d in a:b with q >= d
+            q = max(d, cld(a, d))
+            for m in q*d:d:b
+                sums[m - a + 1] += q == d ? d : d + q
+                q += 1
+            end
+        end
+        @inbounds for m in a:b
+            sums[m - a + 1] == 2m && (out[m - lo + 1] = true)
         end
     end
-    return sum(divisors) == number
+    return out
 end
@@ -12,9 +12,21 @@ perfect_square(0)   # returns True
 perfect_square(10)  # returns False
 ```
 
+Integers are checked exactly: most non squares are rejected by their value modulo 64
+(a square is one of 12 values out of 64), the others by the integer square root `isqrt`.
+
 Contributed By:- [Ashwani Rathee](https://github.com/ashwani-rathee)
 """
 function perfect_square(number)
     return sqrt(number) * sqrt(number) == number
 end
-perfect_square(9)
\ No newline at end of file
+
+# Bit i is set when i is a square modulo 64
+const SQUARES_MOD_64 = reduce(|, (UInt64(1) << (i * i % 64) for i in 0:63))
+
+function perfect_square(number::Integer)
+    number < 0 && return false
+    (SQUARES_MOD_64 >> Int(number & 63)) & 1 == 1 || return false
+    root = isqrt(number)
+    return root * root == number
+end
@@ -1,10 +1,15 @@
 """
 prime_check(number)
+prime_check(table::PrimeTable, number)
 
 Checks to see if a number is a prime or not
     
 A number is prime if it has exactly two factors: 1 and itself.
 
+Numbers up to the limit of the `PrimeTable` (2^16 by default) are looked up in it. Bigger ones
+are tried against the first primes, then go through a Miller–Rabin test, which is
+deterministic for 64-bit numbers (see `miller_rabin`).
+
 # Example
 
 ```julia
@@ -18,23 +23,29 @@ prime_check(17) # returns true
 prime_check(19) # returns true
 prime_check(23) # returns true
 prime_check(29) # returns true
+prime_check(2^61 - 1) # returns true
 ```
 
 Contributed By:- [Ashwani Rathee](https://github.com/ashwani-rathee)
 """
-function prime_check(number)
-    if 1 < number < 4
-        # 2, 3 are primes
-        return true
-    elseif number < 2 || number % 2 == 0
-        # Negative ,0,1, and even numbers except 2 are not primes
+prime_check(number::Integer) = prime_check(SMALL_PRIMES, number)
+
+function prime_check(table::PrimeTable, number::Integer)
+    # Miller–Rabin needs the numbers up to 37 in the table
+    table.limit < SMALL_PRIMES.limit && (table = SMALL_PRIMES)
+    if number < 2
+        # Negative ,0 and 1 are not primes
         return false
+    elseif number <= table.limit
+        return in_table(table, number)
     end
-    odd_numbers = collect(3:2:trunc(sqrt(number) + 1))
-    for i in odd_numbers
-        if number % i == 0
+    for p in (2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37)
+        if number % p == 0
             return false
         end
     end
-    return true
+    return miller_rabin(factor_type(typeof(number))(number))
 end
+
+# Integer valued floats, like 7.0
+prime_check(number::Real) = isinteger(number) && prime_check(BigInt(number))
@@ -1,7 +1,12 @@
 """
 prime_factors(number)
+prime_factors(table::PrimeTable, number)
 
-Returns prime factors of `number` as a vector
+Returns prime factors of `number` as a vector, in increasing order, of the same type as `number`
+
+The primes of the `PrimeTable` (up to 2^16 by default) are tried first. What is left once they
+are all divided out is either 1, a prime (see `prime_check`), or a product of large primes
+which are split apart with Pollard's rho algorithm (see `pollard_rho`).
 
 # Example
 
@@ -14,23 +19,68 @@ prime_factors(10^-2)       # returns []
 prime_factors(0.02)        # returns []
 prime_factors(10^-354)     # returns []
 prime_factors("hello")     # returns error
+prime_factors(1000000007 * 998244353) # returns [998244353, 1000000007]
 ```
 
 Contributed By:- [Ashwani Rathee](https://github.com/ashwani-rathee)
 """
-function prime_factors(number)
-    i = 2
-    factors = []
-    while i^2 <= number
-        if number % i == 1
-            i += 1
+prime_factors(number::Integer) = prime_factors(SMALL_PRIMES, number)
+
+prime_factors(table::PrimeTable, number::T) where T <: Integer = push_prime_factors!(T[], table, number)
+
+"""
+    prime_factors!(ws::Workspace, number)
+    prime_factors!(ws::Workspace, table::PrimeTable, number)
+
+Same factors as `prime_factors`, for an integer `number`, in a vector of the
+workspace `ws`: nothing is allocated once it has grown to the number of
+factors, unless Pollard's rho is needed.
+"""
+prime_factors!(ws::Workspace, number::Integer) = prime_factors!(ws, SMALL_PRIMES, number)
+
+prime_factors!(ws::Workspace, table::PrimeTable, number::T) where T <: Integer =
+    push_prime_factors!(acquire!(ws, Vector{T}), table, number)
+
+function push_prime_factors!(factors::Vector{T}, table::PrimeTable, number::T) where T <: Integer
+    number < 2 && return factors
+    # Pollard's rho needs the small factors out of the way
+    table.limit < SMALL_PRIMES.limit && (table = SMALL_PRIMES)
+    n = factor_type(T)(number)
+    for p in table.primes
+        p > n ÷ p && break
+        while n % p == 0
+            n ÷= p
+            push!(factors, T(p))
+        end
+    end
+    if n > 1
+        # n has no factor in the table, so it is a prime if it is below (limit + 1)^2
+        if n ÷ (table.limit + 1) <= table.limit
+            push!(factors, T(n))
         else
-            number ÷= i
-            push!(factors, i)
+            large_prime_factors!(factors, n)
+            sort!(factors)
         end
     end
-    if number > 1 == 1
-        push!(factors, number)
+    return factors
+end
+
+# Pushes the prime factors of n, which has no small factor, to factors
+function large_prime_factors!(factors::Vector{T}, n::Integer) where T
+    n == 1 && return factors
+    if miller_rabin(n)
+        push!(factors, T(n))
+    else
+        d = pollard_rho(n)
+        large_prime_factors!(factors, d)
+        large_prime_factors!(factors, n ÷ d)
     end
     return factors
 end
+
+# Fractions have no prime factors, integer valued floats have those of the integer
+function prime_factors(number::Real)
+    number < 2 && return typeof(number)[]
+    isinteger(number) || throw(DomainError(number, "prime_factors() needs an integer"))
+    return typeof(number).(prime_factors(BigInt(number)))
+end
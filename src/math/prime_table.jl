@@ -0,0 +1,203 @@
+"""
+    PrimeTable(limit; ntasks=Threads.nthreads())
+
+All the primes up to `limit` (at most `typemax(UInt32)`), in increasing order in
+the field `primes`, found with a segmented Sieve of Eratosthenes.
+
+Only odd numbers are sieved, one segment of `SIEVE_SEGMENT` of them at a time,
+so that the segment stays in the L1/L2 cache while every prime up to `√limit`
+crosses out its multiples in it. The segments are shared out between `ntasks`
+tasks, each one with its own buffer.
+
+`prime_check(table, n)` and `prime_factors(table, n)` use the table, while
+`prime_check(n)` and `prime_factors(n)` use a table of the primes below 2^16.
+
+# Example
+
+```julia
+table = PrimeTable(100)
+table.primes               # returns [2, 3, 5, 7, ..., 89, 97]
+length(PrimeTable(10^6))   # returns 78498
+```
+"""
+struct PrimeTable
+    limit::Int
+    primes::Vector{UInt32}
+end
+
+# Odd numbers sieved at a time
+const SIEVE_SEGMENT = 1 << 15
+
+function PrimeTable(limit::Integer; ntasks::Integer = Threads.nthreads())
+    limit <= typemax(UInt32) || throw(ArgumentError("PrimeTable() holds primes up to typemax(UInt32)"))
+    limit < 2 && return PrimeTable(Int(limit), UInt32[])
+    limit = Int(limit)
+    # the odd numbers 3, 5, ..., limit are 2j + 1 for j in 1:last_odd
+    last_odd = (limit - 1) ÷ 2
+    last_odd == 0 && return PrimeTable(limit, UInt32[2])
+    base_primes = odd_primes_upto(isqrt(limit))
+    parts = sieve_tasks((lo, hi) -> odd_primes_between(UInt32, base_primes, lo, hi), 1, last_odd, ntasks)
+    return PrimeTable(limit, vcat(UInt32[2], parts...))
+end
+
+# Results of kernel(lo, hi) for ntasks slices lo:hi of first:last, in parallel,
+# cut at multiples of SIEVE_SEGMENT from first
+function sieve_tasks(kernel, first::Int, last::Int, ntasks::Integer)
+    nsegments = cld(last - first + 1, SIEVE_SEGMENT)
+    ntasks = max(min(ntasks, nsegments), 1)
+    ntasks == 1 && return [kernel(first, last)]
+    bounds = [first + SIEVE_SEGMENT * ((nsegments * t) ÷ ntasks) for t in 0:ntasks]
+    bounds[end] = last + 1
+    tasks = [Threads.@spawn kernel(bounds[t], bounds[t+1] - 1) for t in 1:ntasks]
+    return map(fetch, tasks)
+end
+
+# Odd primes up to n, with a plain sieve
+function odd_primes_upto(n::Int)
+    is_prime = trues(n)
+    primes = Int[]
+    for i in 3:2:n
+        is_prime[i] || continue
+        push!(primes, i)
+        for k in i*i:2i:n
+            is_prime[k] = false
+        end
+    end
+    return primes
+end
+
+# Primes 2j + 1 for j in first:last, as a vector of T
+function odd_primes_between(::Type{T}, base_primes::Vector{Int}, first::Int, last::Int) where T
+    primes = T[]
+    sieve_segments(base_primes, first, last) do segment, lo
+        @inbounds for k in eachindex(segment)
+            segment[k] && push!(primes, T(2(lo + k - 1) + 1))
+        end
+    end
+    return primes
+end
+
+# Number of primes 2j + 1 for j in first:last
+function count_odd_primes_between(base_primes::Vector{Int}, first::Int, last::Int)
+    n = Ref(0)
+    sieve_segments((segment, lo) -> n[] += count(segment), base_primes, first, last)
+    return n[]
+end
+
+# Sieves the odd numbers 2j + 1 for j in first:last one segment at a time, and
+# calls found(segment, lo) for each one: segment[k] tells whether 2(lo + k - 1) + 1 is a prime
+function sieve_segments(found, base_primes::Vector{Int}, first::Int, last::Int)
+    segment = Vector{Bool}(undef, SIEVE_SEGMENT)
+    for lo in first:SIEVE_SEGMENT:last
+        hi = min(lo + SIEVE_SEGMENT - 1, last)
+        fill!(segment, true)
+        @inbounds for p in base_primes
+            p * p > 2hi + 1 && break
+            # first odd multiple of p in the segment, p^2 at least
+            m = max(p * p, cld(2lo + 1, p) * p)
+            iseven(m) && (m += p)
+            for j in (m - 1) ÷ 2:p:hi
+                segment[j - lo + 1] = false
+            end
+        end
+        found(view(segment, 1:hi-lo+1), lo)
+    end
+    return nothing
+end
+
+Base.length(table::PrimeTable) = length(table.primes)
+
+# Primes below 2^16, enough to find the factors of up to 32 bits by trial division
+const SMALL_PRIMES = PrimeTable(1 << 16; ntasks = 1)
+
+# Whether n <= table.limit is one of the primes of table
+function in_table(table::PrimeTable, n::Integer)
+    i = searchsortedfirst(table.primes, n)
+    return i <= length(table.primes) && table.primes[i] == n
+end
+
+# Type in which n > 0 is factored: unsigned for machine integers, so that n + c
+# cannot overflow in Pollard's rho
+factor_type(::Type{T}) where T <: Integer = promote_type(T, UInt64)
+factor_type(::Type{T}) where T <: Signed = T <: Base.BitInteger ? unsigned(promote_type(T, Int64)) : T
+
+mulmod(a::T, b::T, n::T) where T <: Integer = oftype(n, widemul(a, b) % n)
+addmod(a::T, b::T, n::T) where T <: Integer = a >= n - b ? a - (n - b) : a + b
+
+"""
+    miller_rabin(n)
+
+Miller–Rabin test of the odd number `n > 37` with the first 12 primes as
+bases, which is deterministic below 3.18 * 10^23 (so for any 64-bit `n`), and
+a strong probable prime test beyond.
+
+# Reference
+- Sorenson & Webster, Strong pseudoprimes to twelve prime bases -- https://arxiv.org/abs/1509.00864
+"""
+function miller_rabin(n::T) where T <: Integer
+    d = n - one(T)
+    s = trailing_zeros(d)
+    d >>= s
+    for a in (2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37)
+        x = powermod(T(a), d, n)
+        (x == 1 || x == n - 1) && continue
+        composite = true
+        for _ in 1:s-1
+            x = mulmod(x, x, n)
+            if x == n - 1
+                composite = false
+                break
+            end
+        end
+        composite && return false
+    end
+    return true
+end
+
+# Batch of steps between two gcds in pollard_rho
+const RHO_BATCH = 128
+
+"""
+    pollard_rho(n)
+
+A non trivial factor of the odd composite `n`, with Brent's variant of Pollard's
+rho: the sequence `x -> x^2 + c (mod n)` is expected to cycle modulo a prime
+factor `p` of `n` after about `√p` steps, then `gcd(x - y, n)` reveals `p`. The
+differences are multiplied together over `RHO_BATCH` steps before a single gcd.
+
+# Reference
+- Brent, An improved Monte Carlo factorization algorithm (1980)
+"""
+function pollard_rho(n::T) where T <: Integer
+    for c in one(T):T(100)
+        y, q, g = T(2), one(T), one(T)
+        x = ys = y
+        r = 1
+        while g == 1
+            x = y
+            for _ in 1:r
+                y = addmod(mulmod(y, y, n), c, n)
+            end
+            k = 0
+            while k < r && g == 1
+                ys = y
+                for _ in 1:min(RHO_BATCH, r - k)
+                    y = addmod(mulmod(y, y, n), c, n)
+                    q = mulmod(q, x > y ? x - y : y - x, n)
+                end
+                g = gcd(q, n)
+                k += RHO_BATCH
+            end
+            r *= 2
+        end
+        if g == n # the batch went past the factor, redo it one step at a time
+            g = one(T)
+            while g == 1
+                ys = addmod(mulmod(ys, ys, n), c, n)
+                g = gcd(x > ys ? x - ys : ys - x, n)
+            end
+        end
+        g != n && return g
+    end
+    throw(ArgumentError("pollard_rho() found no factor of $n"))
+end
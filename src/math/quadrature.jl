@@ -0,0 +1,253 @@
+"""
+    trapezoid(y, h)
+    trapezoid(y, x)
+    simpson(y, h)
+
+Integral of the function sampled as `y`, at points spaced by `h` or at the
+sorted points `x`, by the composite trapezoidal rule or Simpson's rule.
+Simpson's rule needs an odd number of samples; with an even number, the last
+three intervals follow Simpson's 3/8 rule. The sums are `@simd` reductions
+over the samples.
+
+`trapezoid!(out, Y, h)` and `simpson!(out, Y, h)` integrate each column of the
+matrix `Y`, in `ntasks` tasks.
+
+# Example
+
+```julia
+x = range(0, π, length = 101)
+trapezoid(sin.(x), step(x))   # returns 1.9998355038874436
+simpson(sin.(x), step(x))     # returns 2.0000000108245044
+```
+"""
+function trapezoid(y::AbstractVector, h::Real)
+    n = length(y)
+    n < 2 && return zero(float(eltype(y))) * h
+    s = zero(float(eltype(y)))
+    @inbounds @simd for i in firstindex(y)+1:lastindex(y)-1
+        s += y[i]
+    end
+    return h * (s + (y[begin] + y[end]) / 2)
+end
+
+function trapezoid(y::AbstractVector, x::AbstractVector)
+    length(y) == length(x) || throw(DimensionMismatch("$(length(y)) samples at $(length(x)) points"))
+    Base.require_one_based_indexing(y, x)
+    s = zero(float(eltype(y))) * zero(float(eltype(x)))
+    @inbounds @simd for i in 1:length(y)-1
+        s += (x[i + 1] - x[i]) * (y[i] + y[i + 1])
+    end
+    return s / 2
+end
+
+function simpson(y::AbstractVector, h::Real)
+    Base.require_one_based_indexing(y)
+    n = length(y)
+    n < 3 && return trapezoid(y, h)
+    # Simpson's rule on 1:m, m odd, and the 3/8 rule on m:n for an even n
+    m = isodd(n) ? n : n - 3
+    s = zero(float(eltype(y)))
+    if m >= 3
+        odd = zero(s)
+        even = zero(s)
+        @inbounds @simd for i in 2:2:m-1
+            odd += y[i]
+        end
+        @inbounds @simd for i in 3:2:m-2
+            even += y[i]
+        end
+        s = h * (y[1] + y[m] + 4 * odd + 2 * even) / 3
+    end
+    if m < n
+        @inbounds s += 3h * (y[m] + 3 * y[m + 1] + 3 * y[m + 2] + y[m + 3]) / 8
+    end
+    return s
+end
+
+function trapezoid!(out::AbstractVector, Y::AbstractMatrix, h::Real; ntasks::Integer = Threads.nthreads())
+    return integrate_columns!(trapezoid, out, Y, h, ntasks)
+end
+
+function simpson!(out::AbstractVector, Y::AbstractMatrix, h::Real; ntasks::Integer = Threads.nthreads())
+    return integrate_columns!(simpson, out, Y, h, ntasks)
+end
+
+function integrate_columns!(rule, out, Y, h, ntasks)
+    n = size(Y, 2)
+    length(out) == n || throw(DimensionMismatch("$n columns but $(length(out)) outputs"))
+    Base.require_one_based_indexing(out, Y)
+    # tasks get 2^16 samples at least
+    ntasks = clamp(ntasks, 1, max(1, length(Y) >> 16))
+    bounds = [1 + (n * t) ÷ ntasks for t in 0:ntasks]
+    @sync for t in 1:ntasks
+        Threads.@spawn for j in bounds[t]:bounds[t+1]-1
+            out[j] = rule(view(Y, :, j), h)
+        end
+    end
+    return out
+end
+
+# Nodes of the 15 point Kronrod rule in [0, 1), the even ones being those of the
+# 7 point Gauss rule, and their weights
+const KRONROD_NODES = (0.991455371120812639206854697526329, 0.949107912342758524526189684047851,
+    0.864864423359769072789712788640926, 0.741531185599394439863864773280788,
+    0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+    0.207784955007898467600689403773245, 0.0)
+const KRONROD_WEIGHTS = (0.022935322010529224963732008058970, 0.063092092629978553290700663189204,
+    0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+    0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+    0.204432940075298892414161999234649, 0.209482141084727828012999174891714)
+const GAUSS_WEIGHTS = (0.129484966168869693270611432679082, 0.279705391489276667901467771423780,
+    0.381830050505118944950369775488975, 0.417959183673469387755102040816327)
+
+# Kronrod estimate of the integral of f over [a, b] and its difference with the Gauss one
+function kronrod_segment(f, a, b)
+    c = (a + b) / 2
+    r = (b - a) / 2
+    fc = f(c)
+    kronrod = KRONROD_WEIGHTS[8] * fc
+    gauss = GAUSS_WEIGHTS[4] * fc
+    for i in 1:7
+        fx = f(c - r * KRONROD_NODES[i]) + f(c + r * KRONROD_NODES[i])
+        kronrod += KRONROD_WEIGHTS[i] * fx
+        iseven(i) && (gauss += GAUSS_WEIGHTS[i ÷ 2] * fx)
+    end
+    return r * kronrod, abs(r * (kronrod - gauss))
+end
+
+"""
+    gauss_kronrod(f, a, b; atol=0, rtol=sqrt(eps()), maxevals=10^7)
+
+Integral of `f` over `[a, b]` and an estimate of its error, by adaptive
+Gauss-Kronrod quadrature: the 15 point Kronrod rule is applied to each
+segment, the 7 point Gauss rule at the same nodes giving its error. The
+segment with the largest error is bisected until the total error is below
+`max(atol, rtol * abs(integral))` or `maxevals` evaluations are reached. The
+segments are kept in a binary heap, by error.
+
+`gauss_kronrod!(out, f, a, b; ntasks)` integrates over the intervals
+`[a[i], b[i]]`, the function `f`, or `f[i]` for a vector of functions, in
+`ntasks` tasks.
+
+# Example
+
+```julia
+integral, error = gauss_kronrod(x -> exp(-x^2), -10, 10)   # integral ≈ sqrt(π)
+gauss_kronrod(x -> 1 / sqrt(x), 0, 1)     # ≈ 2, bisecting more and more near 0
+```
+
+# Reference
+- Piessens et al., QUADPACK (1983)
+"""
+function gauss_kronrod(f, a::Real, b::Real; atol::Real = 0, rtol::Real = sqrt(eps()), maxevals::Integer = 10^7)
+    a, b = promote(float(a), float(b))
+    integral, error = kronrod_segment(f, a, b)
+    tolerance(integral) = max(atol, rtol * abs(integral))
+    error <= tolerance(integral) && return integral, error
+    # segments (error, a, b, integral), as a max-heap by error
+    segments = [(error, a, b, integral)]
+    evals = 15
+    while error > tolerance(integral) && evals < maxevals
+        e, lo, hi, s = segment_pop!(segments)
+        mid = (lo + hi) / 2
+        s1, e1 = kronrod_segment(f, lo, mid)
+        s2, e2 = kronrod_segment(f, mid, hi)
+        evals += 30
+        integral += s1 + s2 - s
+        error += e1 + e2 - e
+        segment_push!(segments, (e1, lo, mid, s1))
+        segment_push!(segments, (e2, mid, hi, s2))
+    end
+    # sum again, without the rounding errors of the updates
+    integral = sum(segment -> segment[4], segments)
+    error = sum(segment -> segment[1], segments)
+    return integral, error
+end
+
+function segment_push!(heap::Vector, x)
+    push!(heap, x)
+    i = length(heap)
+    @inbounds while i > 1 && heap[i >> 1][1] < heap[i][1]
+        heap[i], heap[i >> 1] = heap[i >> 1], heap[i]
+        i >>= 1
+    end
+    return heap
+end
+
+function segment_pop!(heap::Vector)
+    top = heap[1]
+    last = pop!(heap)
+    isempty(heap) && return top
+    heap[1] = last
+    i = 1
+    n = length(heap)
+    @inbounds while 2i <= n
+        c = 2i
+        c + 1 <= n && heap[c + 1][1] > heap[c][1] && (c += 1)
+        heap[c][1] > heap[i][1] || break
+        heap[i], heap[c] = heap[c], heap[i]
+        i = c
+    end
+    return top
+end
+
+function gauss_kronrod!(out::AbstractVector, f, a::AbstractVector, b::AbstractVector;
+        atol::Real = 0, rtol::Real = sqrt(eps()), ntasks::Integer = Threads.nthreads())
+    n = length(out)
+    length(a) == n && length(b) == n || throw(DimensionMismatch("$n outputs for $(length(a)) and $(length(b)) bounds"))
+    f isa AbstractVector && length(f) != n && throw(DimensionMismatch("$n outputs for $(length(f)) functions"))
+    Base.require_one_based_indexing(out, a, b)
+    ntasks = clamp(ntasks, 1, max(1, n))
+    bounds = [1 + (n * t) ÷ ntasks for t in 0:ntasks]
+    @sync for t in 1:ntasks
+        Threads.@spawn for i in bounds[t]:bounds[t+1]-1
+            out[i] = first(gauss_kronrod(f isa AbstractVector ? f[i] : f, a[i], b[i]; atol = atol, rtol = rtol))
+        end
+    end
+    return out
+end
+
+"""
+    romberg(f, a, b; atol=0, rtol=sqrt(eps()), maxlevels=20)
+
+Integral of `f` over `[a, b]` and an estimate of its error, by Romberg's
+method: the trapezoidal rule with `2^k` intervals, `k = 0, 1, ...`, reusing
+the previous evaluations, and Richardson extrapolation of its successive
+values, until two diagonal terms of the table differ by less than
+`max(atol, rtol * abs(integral))`, or `maxlevels` levels. It suits smooth
+functions, for which the error falls quickly.
+
+# Example
+
+```julia
+integral, error = romberg(sin, 0, π)   # integral ≈ 2
+```
+"""
+function romberg(f, a::Real, b::Real; atol::Real = 0, rtol::Real = sqrt(eps()), maxlevels::Integer = 20)
+    maxlevels >= 2 || throw(ArgumentError("Romberg's method needs 2 levels at least"))
+    a, b = promote(float(a), float(b))
+    h = b - a
+    # the last row of the table, updated in place
+    row = zeros(typeof(h * f(a)), maxlevels)
+    row[1] = h * (f(a) + f(b)) / 2
+    for k in 2:maxlevels
+        # the trapezoidal rule with 2^(k - 1) intervals, from the one with half as many
+        h /= 2
+        s = zero(eltype(row))
+        for i in 1:2:(1 << (k - 1))
+            s += f(a + i * h)
+        end
+        previous = row[1]
+        row[1] = row[1] / 2 + h * s
+        scale = 1
+        for j in 2:k
+            scale *= 4
+            extrapolated = row[j - 1] + (row[j - 1] - previous) / (scale - 1)
+            j < k && (previous = row[j])
+            row[j] = extrapolated
+        end
+        error = abs(row[k] - row[k - 1])
+        error <= max(atol, rtol * abs(row[k])) && return row[k], error
+    end
+    return row[maxlevels], abs(row[maxlevels] - row[maxlevels - 1])
+end
@@ -1,10 +1,18 @@
 # Based on the introductory discussion on
 # https://www.maa.org/press/periodicals/loci/joma/the-sir-model-for-spread-of-disease-the-differential-equation-model
 
-## Uncomment the following lines if used as a standalone
-# using DifferentialEquations
-# using Plots
+"""
+    SIR(du, u, p, t)
+    SIR(u, p, t)
 
+Right-hand side of the SIR model of an epidemic, with `u = (s, i, r)` the
+susceptible, infected and recovered numbers and `p = (b, k)` the rates of
+infection and recovery: `s' = -b s i`, `i' = b s i - k i` and `r' = k i`.
+The first form writes the derivatives to `du`, the second one returns them as
+an `SVector`, for `solve_ode!` and `solve_ensemble!`.
+
+See also `solve_sir`.
+"""
 function SIR(du, u, p, t)
     s, i, r = u
     b, k = p
@@ -13,15 +21,32 @@ function SIR(du, u, p, t)
     du[3] = k * i
 end
 
-# TODO: make the following a doctest example
-    # #initian conditions
-    # p = [0.5/7900000.0,0.33]
-    # u0 = [7900000.0,10.0,0.0]
-    # tspan = (0.0,140.0)
+function SIR(u, p, t)
+    s, i, r = u
+    b, k = p
+    return SVector(-b * s * i, b * s * i - k * i, k * i)
+end
 
-    # #solve
-    # sir = ODEProblem(SIR,u0,tspan,p)
-    # sol = solve(sir)
+"""
+    solve_sir(u0, tspan, p; ts=range(tspan..., length=101), method=DormandPrince(reltol=1.0e-6))
 
-    # #plot
-    # plot(sol)
+Solves the `SIR` model from the numbers `u0 = (s, i, r)` with the rates `p = (b, k)`
+through `tspan`, and returns the states at the times `ts`, as `SVector`s.
+
+# Example
+
+```julia
+p = [0.5 / 7900000.0, 0.33]
+u0 = [7900000.0, 10.0, 0.0]
+us = solve_sir(u0, (0.0, 140.0), p)
+maximum(u -> u[2], us)    # peak of the number of infected
+```
+"""
+function solve_sir(u0, tspan, p; ts = range(tspan[1], tspan[2], length = 101),
+        method::ODEMethod = DormandPrince(reltol = 1.0e-6))
+    length(u0) == 3 || throw(DimensionMismatch("the SIR model has 3 compartments, not $(length(u0))"))
+    u = SVector{3}(float.(Tuple(u0)))
+    us = Vector{typeof(u)}(undef, length(ts))
+    solve_ode!(us, ts, method, SIR, u, tspan, SVector{2}(float.(Tuple(p))))
+    return us
+end
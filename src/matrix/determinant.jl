@@ -5,22 +5,95 @@ Given a non singluar matrix, calculate its determinant using LU decomposition.
 
 L and U are lower triangular and upper triangular matrices respectively such that
 
-A = L*U
+P*A = L*U
 
-If we want to find the determinant, then
+where the permutation P exchanges the rows swapped while pivoting. If we want to find the determinant, then
 
-det(A) = det(LU) = det(L)*det(U)
+det(A) = det(P)*det(L)*det(U)
 
-Determinant of triangualar matrices is the product of their diagonal entries. Hence, makes finding the determinant easy.
+Determinant of triangualar matrices is the product of their diagonal entries, and the diagonal of L is all ones.
+det(P) is -1 for an odd number of row exchanges and 1 otherwise. Hence, makes finding the determinant easy.
+
+For many matrices of the same size, `determinant!` reuses one `LUWorkspace` and does not allocate.
 """
 function determinant(mat)
 	n, m = size(mat)
 	if n != m
-		DomainError(mat, "The matrix should be a square matrix.")
+		throw(DomainError(mat, "The matrix should be a square matrix."))
+	end
+	return determinant!(LUWorkspace(mat), mat)
+end
+
+"""
+    determinant!(F::LUWorkspace, mat)
+
+Determinant of `mat`, factored in the workspace `F` with `lu_decompose!`.
+"""
+determinant!(F::LUWorkspace, mat) = determinant(lu_decompose!(F, mat))
+
+"""
+    determinant(F::LUWorkspace)
+
+Determinant of the matrix last factored in `F`.
+"""
+function determinant(F::LUWorkspace)
+	LU = F.factors
+	d = one(eltype(LU))
+	@inbounds for i in axes(LU, 1)
+		d *= LU[i,i]
+		if F.pivots[i] != i
+			d = -d
+		end
 	end
-	L, U = lu_decompose(mat)
-	l_prod = prod([L[i,i] for i in 1:n])
-	u_prod = prod([U[i,i] for i in 1:n])
+	return d
+end
+
+"""
+    determinant(mat::StaticMatrix)
 
-	return l_prod * u_prod
+Determinant of a small matrix from StaticArrays, without allocating: the size is known at compile time,
+so the formulas below are unrolled. Up to 3x3 they are the cofactor expansions, bigger matrices are
+reduced to an upper triangular one by Gaussian elimination with partial pivoting, held in registers.
+"""
+function determinant(mat::StaticMatrix{N,N,T}) where {N,T}
+	S = float(T)
+	if N == 0
+		return one(S)
+	elseif N == 1
+		return S(mat[1,1])
+	elseif N == 2
+		return S(mat[1,1] * mat[2,2] - mat[1,2] * mat[2,1])
+	elseif N == 3
+		return S(
+			mat[1,1] * (mat[2,2] * mat[3,3] - mat[2,3] * mat[3,2]) -
+			mat[1,2] * (mat[2,1] * mat[3,3] - mat[2,3] * mat[3,1]) +
+			mat[1,3] * (mat[2,1] * mat[3,2] - mat[2,2] * mat[3,1])
+		)
+	end
+
+	U = MMatrix{N,N,S}(mat)
+	d = one(S)
+	@inbounds for i in 1:N
+		p = i
+		for k in i+1:N
+			if abs(U[k,i]) > abs(U[p,i])
+				p = k
+			end
+		end
+		if p != i
+			for j in i:N
+				U[i,j], U[p,j] = U[p,j], U[i,j]
+			end
+			d = -d
+		end
+		iszero(U[i,i]) && return zero(S)
+		d *= U[i,i]
+		for k in i+1:N
+			l = U[k,i] / U[i,i]
+			for j in i+1:N
+				U[k,j] -= l * U[i,j]
+			end
+		end
+	end
+	return d
 end
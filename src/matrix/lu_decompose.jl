@@ -1,15 +1,19 @@
 """
     lu_decompose(mat)
 Decomposes a `n x n` non singular matrix into a lower triangular matrix (L) and an upper triangular matrix (U)
+
+No rows are exchanged, so a zero (or tiny) pivot breaks it: see `lu_decompose!` for a pivoted,
+allocation free version.
 """
 function lu_decompose(mat)
 	n = mat |> size |> first
-	L = zeros(n, n)
-	U = zeros(n, n)
+	T = float(eltype(mat))
+	L = zeros(T, n, n)
+	U = zeros(T, n, n)
 
 	for i in 1:n
 		for j in i:n
-			s = 0
+			s = zero(T)
 			for k in 1:i
 				s += L[i,k] * U[k,j]
 			end
@@ -19,8 +23,8 @@ function lu_decompose(mat)
 		for k in i:n
 			if i == k
 				L[i,i] = 1
-    			else
-				s = 0
+			else
+				s = zero(T)
 				for j in 1:i
 					s += L[k,j] * U[j,i]
 				end
@@ -31,3 +35,164 @@ function lu_decompose(mat)
 
 	return L, U
 end
+
+"""
+    LUWorkspace{T}(n)
+    LUWorkspace(mat)
+
+Storage for the LU factorization of `n x n` matrices with elements of type `T`
+(`float(eltype(mat))` for the second form), filled by `lu_decompose!`.
+
+- `factors`: L and U packed in one matrix, U on and above the diagonal and L,
+  whose diagonal is all ones, below it;
+- `pivots`: row `i` was exchanged with row `pivots[i]` at step `i`.
+
+A workspace can be reused for any number of matrices of the same size.
+"""
+struct LUWorkspace{T}
+	factors::Matrix{T}
+	pivots::Vector{Int}
+end
+
+LUWorkspace{T}(n::Integer) where T = LUWorkspace{T}(Matrix{T}(undef, n, n), Vector{Int}(undef, n))
+LUWorkspace(mat::AbstractMatrix) = LUWorkspace{float(eltype(mat))}(LinearAlgebra.checksquare(mat))
+
+# LUWorkspace held in a Workspace, for lu_decompose!(ws, mat)
+new_buffer(::Type{LUWorkspace{T}}, (n,)::Tuple{Int}) where T = LUWorkspace{T}(n)
+reuse_buffer!(F::LUWorkspace{T}, (n,)::Tuple{Int}) where T = size(F.factors, 1) == n ? F : LUWorkspace{T}(n)
+
+# Columns factored together by lu_decompose!, the rest of the matrix is then updated with a matrix product
+const LU_BLOCK_SIZE = 64
+
+"""
+    lu_decompose!(F::LUWorkspace, mat)
+
+LU factorization with partial pivoting, `P*mat = L*U`, stored in `F` without allocating.
+`mat` is left untouched. Returns `F`.
+
+The columns are factored in blocks of `LU_BLOCK_SIZE`: once a block is done, the
+rows on its right are solved with a triangular solve and the trailing matrix is updated
+with one matrix product. For `Float32`/`Float64` these are BLAS-3 calls (`trsm`, `gemm`),
+which are cache blocked and multithreaded. Any other element type (`BigFloat`, dual
+numbers, ...) goes through the generic Julia code.
+
+A singular matrix is factored too, with a zero on the diagonal of U.
+
+# Example
+
+```julia
+A = rand(500, 500)
+F = LUWorkspace(A)
+for _ in 1:1000
+	rand!(A)
+	determinant(lu_decompose!(F, A))
+end
+```
+"""
+function lu_decompose!(F::LUWorkspace{T}, mat::AbstractMatrix) where T
+	LU = F.factors
+	size(mat) == size(LU) || throw(DimensionMismatch("matrix of size $(size(mat)) in a workspace for $(size(LU))"))
+	n = size(LU, 1)
+	copyto!(LU, mat)
+
+	for k in 1:LU_BLOCK_SIZE:n
+		last = min(k + LU_BLOCK_SIZE - 1, n)
+		lu_panel!(LU, F.pivots, k, last)
+		# Exchange the same rows on both sides of the block
+		for i in k:last
+			p = F.pivots[i]
+			p == i && continue
+			for j in 1:k-1
+				LU[i,j], LU[p,j] = LU[p,j], LU[i,j]
+			end
+			for j in last+1:n
+				LU[i,j], LU[p,j] = LU[p,j], LU[i,j]
+			end
+		end
+		if last < n
+			U12 = view(LU, k:last, last+1:n)
+			unit_lower_ldiv!(view(LU, k:last, k:last), U12)
+			mul!(view(LU, last+1:n, last+1:n), view(LU, last+1:n, k:last), U12, -one(T), one(T))
+		end
+	end
+	return F
+end
+
+"""
+    lu_decompose!(ws::Workspace, mat)
+
+`lu_decompose!(F, mat)` with an `LUWorkspace` of `ws`: the same pivoted
+factorization, returned as an `LUWorkspace` which belongs to `ws`. Nothing is
+allocated once `ws` holds one of this size.
+"""
+lu_decompose!(ws::Workspace, mat::AbstractMatrix) =
+	lu_decompose!(acquire!(ws, LUWorkspace{float(eltype(mat))}, LinearAlgebra.checksquare(mat)), mat)
+
+# Unblocked factorization of the columns k:last, rows k:n, of LU
+function lu_panel!(LU::AbstractMatrix, pivots::Vector{Int}, k::Int, last::Int)
+	n = size(LU, 1)
+	@inbounds for j in k:last
+		p = j
+		for i in j+1:n
+			if abs(LU[i,j]) > abs(LU[p,j])
+				p = i
+			end
+		end
+		pivots[j] = p
+		if p != j
+			for c in k:last
+				LU[j,c], LU[p,c] = LU[p,c], LU[j,c]
+			end
+		end
+		iszero(LU[j,j]) && continue
+		pivot = LU[j,j]
+		for i in j+1:n
+			LU[i,j] /= pivot
+		end
+		for c in j+1:last
+			u = LU[j,c]
+			for i in j+1:n
+				LU[i,c] -= LU[i,j] * u
+			end
+		end
+	end
+	return LU
+end
+
+# B = L \ B, L being the unit lower triangle of L11
+function unit_lower_ldiv!(L11::AbstractMatrix, B::AbstractMatrix)
+	m = size(L11, 1)
+	@inbounds for c in axes(B, 2), j in 1:m
+		b = B[j,c]
+		for i in j+1:m
+			B[i,c] -= L11[i,j] * b
+		end
+	end
+	return B
+end
+
+unit_lower_ldiv!(L11::StridedMatrix{T}, B::StridedMatrix{T}) where T <: LinearAlgebra.BlasFloat =
+	LinearAlgebra.BLAS.trsm!('L', 'L', 'N', 'U', one(T), L11, B)
+
+"""
+    lu_decompose(mat::StaticMatrix)
+
+Same decomposition for a square matrix from StaticArrays, returning `L` and `U` as `SMatrix`.
+The size is known at compile time, so the loops are unrolled and nothing is allocated.
+"""
+function lu_decompose(mat::StaticMatrix{N,N,T}) where {N,T}
+	S = float(T)
+	L = MMatrix{N,N,S}(I)
+	U = MMatrix{N,N,S}(mat)
+	@inbounds for i in 1:N
+		for k in i+1:N
+			l = U[k,i] / U[i,i]
+			L[k,i] = l
+			U[k,i] = zero(S)
+			for j in i+1:N
+				U[k,j] -= l * U[i,j]
+			end
+		end
+	end
+	return SMatrix(L), SMatrix(U)
+end
@@ -3,13 +3,77 @@ A 2D Rotation matrix is a mtrix that rotates a vector in a 2D real space by an a
 For more info: https://en.wikipedia.org/wiki/Rotation_matrix
 
 This function takes the angle `theta` in radians as input and returns a 2D Matrix which will rotate the the vector by angle `theta`.
+
+The matrix is a 2x2 `SMatrix` from StaticArrays: it lives on the stack, so creating it does not allocate.
+"""
+function rotation_matrix(θ::Real)
+	c = cos(θ)
+	s = sin(θ)
+	return @SMatrix [c -s; s c]
+end
+
+"""
+    rotation_matrix(axis, θ)
+
+3D rotation by the angle `θ` (in radians) around `axis`, a vector of length 3 which does not need to be normalized,
+as a 3x3 `SMatrix`. Follows the right hand rule: looking from the tip of `axis`, the rotation is counterclockwise.
+
+It is given by Rodrigues' rotation formula, with `u` the unit vector along `axis` and `[u]×` the matrix of the cross product with `u`:
+
+R = cos(θ) I + sin(θ) [u]× + (1 - cos(θ)) u u'
+
+For more info: https://en.wikipedia.org/wiki/Rotation_matrix#Rotation_matrix_from_axis_and_angle
+"""
+function rotation_matrix(axis::AbstractVector, θ::Real)
+	length(axis) == 3 || throw(DimensionMismatch("the rotation axis must have 3 coordinates"))
+	x, y, z = SVector{3}(axis) / norm(axis)
+	c = cos(θ)
+	s = sin(θ)
+	t = 1 - c
+	return @SMatrix [
+		c+x*x*t    x*y*t-z*s  x*z*t+y*s;
+		y*x*t+z*s  c+y*y*t    y*z*t-x*s;
+		z*x*t-y*s  z*y*t+x*s  c+z*z*t
+	]
+end
+
 """
-function rotation_matrix(θ)
-	rot_mat = Matrix{Float64}(undef,2,2)
-	rot_mat[1,1]  = cos(θ)
-	rot_mat[1,2] = -sin(θ)
-	rot_mat[2,1] = sin(θ)
-	rot_mat[2,2] = cos(θ)
+    rotation_matrix(w, x, y, z)
+
+3D rotation given by the quaternion `w + xi + yj + zk`, as a 3x3 `SMatrix`. The quaternion is normalized first,
+the rotation by `θ` around the unit vector `u` being `cos(θ/2) + sin(θ/2) (uxi + uyj + uzk)`.
 
-	return rot_mat
+For more info: https://en.wikipedia.org/wiki/Quaternions_and_spatial_rotation
+"""
+function rotation_matrix(w::Real, x::Real, y::Real, z::Real)
+	n = sqrt(w*w + x*x + y*y + z*z)
+	w, x, y, z = w/n, x/n, y/n, z/n
+	return @SMatrix [
+		1-2*(y*y+z*z)  2*(x*y-w*z)    2*(x*z+w*y);
+		2*(x*y+w*z)    1-2*(x*x+z*z)  2*(y*z-w*x);
+		2*(x*z-w*y)    2*(y*z+w*x)    1-2*(x*x+y*y)
+	]
 end
+
+"""
+    rotate_points!(out, R, points)
+    rotate_points!(points, R)
+
+Stores `R * points[i]` in `out[i]` (in `points[i]` for the second form), for a whole point cloud:
+`points` is a vector of `SVector`s and `R` a matrix of the same dimension, e.g. one from `rotation_matrix`,
+or an angle for 2D points.
+
+The loop has no allocation or bounds check, so it is unrolled and vectorized by the compiler.
+"""
+function rotate_points!(out::AbstractVector{<:StaticVector{D}}, R::StaticMatrix{D,D}, points::AbstractVector{<:StaticVector{D}}) where D
+	length(out) == length(points) || throw(DimensionMismatch("out and points must have the same length"))
+	@inbounds @simd for i in eachindex(out, points)
+		out[i] = R * points[i]
+	end
+	return out
+end
+
+rotate_points!(out::AbstractVector{<:StaticVector{2}}, θ::Real, points::AbstractVector{<:StaticVector{2}}) =
+	rotate_points!(out, rotation_matrix(θ), points)
+
+rotate_points!(points::AbstractVector{<:StaticVector}, R) = rotate_points!(points, R, points)
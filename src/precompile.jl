@@ -0,0 +1,255 @@
+# Precompilation workload: the calls below are compiled into the package image,
+# so that the first call of each function in a new session does not pay for
+# type inference and code generation. They cover the common argument types,
+# Int, Float64 and Float32 arrays and strings, on small inputs.
+#
+# Every exported function is called, except:
+# - distributed_fit, distributed_knapsack, distributed_prime_count,
+#   distributed_primes, distributed_sort, map_shards, mapreduce_shards and
+#   ShardedVector, which need Distributed workers;
+# - enable_instrumentation, which redefines instrumentation_enabled() and so
+#   would invalidate the code compiled here.
+@setup_workload begin
+    ints = [5, 3, 8, 1, 9, 2, 7]
+    floats = [0.5, 2.5, 1.5, 3.0, 0.25]
+    singles = Float32[0.5, 2.5, 1.5, 3.0, 0.25]
+    dna = "AGCTTTTCATTCTGACTGCAACGGGCAATATGTCTCTG"
+
+    @compile_workload begin
+        # instrumentation
+        reset_instrumentation!()
+        instrumentation_counts()
+        instrumentation_sections()
+        report(devnull)
+        report(devnull; format = :json)
+
+        # workspace
+        ws = Workspace()
+        acquire!(ws, Vector{Int}, 3)
+        acquire!(ws, Matrix{Float64}, 2, 2)
+        acquire!(ws, Dict{String,Int})
+        reset!(ws)
+        prime_factors!(ws, 2560)
+        mode!(ws, ints)
+        mode!(ws, ["x", "x", "y"])
+        collatz_sequence!(ws, 27)
+        fcfs!(ws, 3, [1, 2, 3], [10, 5, 8])
+        lu_decompose!(ws, [4.0 3.0; 6.0 3.0])
+        zero_one_pack!(ws, 20, [1, 3, 11], [2, 5, 30])
+        complete_pack!(ws, 20, [1, 3, 11], [2, 5, 30])
+        task_workspace()
+
+        # data_structures
+        tree = BinaryTree{Int}(10, 0)
+        insert!(tree, 1, 10)
+        insert!(tree, 1, 20)
+        depth(tree, 2)
+        height(tree)
+        isleaf(tree, 2)
+        ch(tree, 1, true)
+        left(tree)
+        right(tree)
+        collect(preorder(tree))
+        collect(inorder(tree))
+        collect(postorder(tree))
+        collect(levelorder(tree))
+        compact!(BinaryTree(collect(1:10)))
+        set = DisjointSet(10)
+        merge!(set, [(1, 2), (3, 4), (2, 4)])
+        find(set, 3)
+        set_size(set, 1)
+        num_sets(set)
+        num_sets(merge!(ConcurrentDisjointSet(10), [(1, 2), (3, 4)]; ntasks = 1))
+        index = OrderedIndex{Int,String}()
+        index[2] = "two"
+        index[1] = "one"
+        kth(index, 1)
+        collect(scan(index, 1, 2))
+
+        # knapsack
+        zero_one_pack!(20, [1, 3, 11], [2, 5, 30], zeros(Int, 30))
+        complete_pack!(20, [1, 2, 9], [1, 3, 20], zeros(Int, 30))
+        knapsack!(KnapsackSolver(), 20, [1, 3, 11], [2, 5, 30])
+        subset_sums(10, [3, 5])
+        subset_sums!(falses(11), [3, 5])
+
+        # math
+        abs_max(ints)
+        abs_min(ints)
+        abs_val(-3)
+        abs_val(-2.5)
+        ceil_val(1.3)
+        floor_val(1.3)
+        area_circle(3)
+        area_ellipse(3, 4)
+        area_heron_triangle(5, 12, 13)
+        area_parallelogram(3, 4)
+        area_rectangle(3, 4)
+        area_rhombus(3, 4)
+        area_square(3)
+        area_trapezium(3, 4, 5)
+        area_triangle(3, 4)
+        surfarea_cube(3)
+        surfarea_sphere(3)
+        area_circle!(similar(floats), floats)
+        area_ellipse!(similar(floats), floats, floats)
+        area_heron_triangle!(similar(floats), floats, floats, floats)
+        area_parallelogram!(similar(floats), floats, floats)
+        area_rectangle!(similar(singles), singles, singles)
+        area_rhombus!(similar(floats), floats, floats)
+        area_square!(similar(floats), floats)
+        area_trapezium!(similar(floats), floats, floats, floats)
+        area_triangle!(similar(floats), floats, floats)
+        surfarea_cube!(similar(floats), floats)
+        surfarea_sphere!(similar(floats), floats)
+        area_polygon([0.0, 4.0, 4.0, 0.0], [0.0, 0.0, 3.0, 3.0])
+        area_polygon!(zeros(1), [0.0, 4.0, 4.0, 0.0], [0.0, 0.0, 3.0, 3.0], [1, 5])
+        collatz_sequence(27)
+        collect(CollatzSequence(27))
+        collatz_stopping_times(1:10)
+        collatz_stopping_times!(zeros(Int, 10), 1:10)
+        euler_method((x, t) -> -x, 1.0, (0, 1), 0.25)
+        factorial_fast(20)
+        factorial_iterative(5)
+        factorial_recursive(5)
+        map_predicate(is_armstrong, 1:100)
+        map_predicate(perfect_square, 1:100)
+        perfect_cube(27)
+        perfect_number(28)
+        perfect_numbers(1:100)
+        prime_check(1231)
+        prime_factors(2560)
+        length(PrimeTable(1000))
+        mean(ints)
+        mean(floats)
+        median(ints)
+        median(floats)
+        median!(copy(floats))
+        quantile(floats, 0.25)
+        quantile!(copy(floats), 0.25)
+        mode(ints)
+        line_length(sin, 0, π, 10)
+        sum_ap(1, 1, 10)
+        sum_gp(1, 2, 10)
+        trapazoidal_area(x -> x^2, 0, 1, 10)
+        trapezoid(floats, 0.1)
+        trapezoid!(zeros(2), [floats floats], 0.1)
+        simpson(floats, 0.1)
+        simpson!(zeros(2), [floats floats], 0.1)
+        gauss_kronrod(exp, 0, 1)
+        gauss_kronrod!(zeros(2), exp, [0.0, 0.0], [1.0, 2.0]; ntasks = 1)
+        romberg(sin, 0, π)
+        solve_sir([7900000.0, 10.0, 0.0], (0.0, 14.0), [0.5 / 7900000.0, 0.33])
+        decay! = (du, u, p, t) -> (du .= -p .* u)
+        solve_ode!(zeros(1, 3), [0.0, 0.5, 1.0], RungeKutta4(0.1), decay!, [1.0], (0.0, 1.0), [1.0])
+        solve_ode!(zeros(1, 3), [0.0, 0.5, 1.0], ForwardEuler(0.1), decay!, [1.0], (0.0, 1.0), [1.0];
+            cache = ode_cache([1.0]))
+        solve_ode!((t, u) -> nothing, DormandPrince(), (u, p, t) -> -u, 1.0, (0.0, 1.0))
+        ODECache([1.0])
+        solve_ensemble!(Vector{SVector{3,Float64}}(undef, 2), DormandPrince(), SIR, SVector(7900000.0, 10.0, 0.0),
+            (0.0, 14.0), [SVector(0.5 / 7900000.0, 0.33), SVector(0.4 / 7900000.0, 0.33)]; ntasks = 1)
+
+        # matrix
+        determinant([4.0 3.0; 6.0 3.0])
+        determinant(@SMatrix [4.0 3.0; 6.0 3.0])
+        determinant!(LUWorkspace{Float64}(2), [4.0 3.0; 6.0 3.0])
+        lu_decompose([4.0 3.0; 6.0 3.0])
+        lu_decompose!(LUWorkspace([4.0 3.0; 6.0 3.0]), [4.0 3.0; 6.0 3.0])
+        rotation_matrix(0.5)
+        rotation_matrix([0.0, 0.0, 1.0], 0.5)
+        rotate_points!([SVector(1.0, 0.0), SVector(0.0, 1.0)], rotation_matrix(0.5))
+
+        # project-rosalind
+        count_nucleotides(dna)
+        dna2rna(dna)
+        reverse_complement(dna)
+        String(reverse_complement(PackedDNA(dna)))
+        String(dna2rna(PackedDNA(dna)))
+        count_nucleotides(PackedDNA(dna))
+        nucleotide_counts(PackedDNA(dna))
+        reader = FastxReader(Vector{UInt8}(">seq\nACGT\n"))
+        map(sequence, collect(reader))
+        count_nucleotides(reader)
+        nucleotide_counts(reader)
+        reverse_complement(reader)
+
+        # searches
+        binary_search(sort(ints), 7)
+        exponential_search(sort(ints), 7)
+        interpolation_search(sort(ints), 7)
+        jump_search(sort(ints), 7)
+        linear_search(ints, 7)
+        binary_search(SortedIndex(sort(floats)), 1.5)
+        searchsorted_batch!(zeros(Int, 2), SortedIndex(sort(ints)), [3, 7])
+        adaptive_search(AdaptiveIndex(sort(ints)), 7)
+
+        # sorts
+        for x in (ints, floats, singles)
+            BubbleSort!(copy(x))
+            InsertionSort!(copy(x))
+            MergeSort!(copy(x))
+            ParallelSort!(copy(x); ntasks = 1)
+            QuickSort!(copy(x))
+            RadixSort!(copy(x))
+            SelectionSort!(copy(x))
+        end
+
+        # statistics
+        OLSbeta(floats, [ones(5) floats])
+        solver = fit!(OLSSolver(2), [ones(5) floats], floats)
+        fit!(solver, [ones(5) floats], floats, floats)
+        fit!(solver, [1.0, 2.0], 3.0)
+        fit!(solver, [1.0, 2.0], 3.0, 0.5)
+        coef(solver)
+        coef!(zeros(2), solver)
+        nobs(solver)
+        variance(ints)
+        variance(floats)
+        pearson_correlation(ints, reverse(ints))
+        variance(Moments(floats))
+        linear_fit(CoMoments(floats, floats))
+        covariance(CoMoments(floats, floats))
+        fit!(CountMinSketch(64, 2), ints)[5]
+        quantile(fit!(P2Quantile(0.5), floats))
+        topk(fit!(HeavyHitters{Int}(2; width = 64), ints))
+
+        # strings
+        is_palindrome("racecar")
+        is_palindrome("A man, a plan, a canal: Panama!"; ignore_case = true, ignore_punctuation = true)
+        map_predicate(is_palindrome, ["abba", "abc"])
+        longest_palindrome("forgeeksskeegfor")
+
+        # scheduling
+        fcfs(3, [1, 2, 3], [10, 5, 8])
+        result = simulate!(Scheduler(), FCFS(), [0, 0, 0], [10, 5, 8])
+        average_waiting_time(result)
+        average_turnaround_time(result)
+        simulate!(Scheduler(), SJF(), [0, 0, 0], [6, 8, 3])
+        simulate!(Scheduler(), SRTF(), [0, 1, 2], [8, 4, 9])
+        simulate!(Scheduler(), RoundRobin(4), [0, 0, 0], [24, 3, 3])
+        simulate!(Scheduler(), PriorityScheduling(), [0, 1, 4], [5, 2, 2], [1, 3, 1])
+
+        # conversions
+        celsius_to_fahrenheit(20.0)
+        celsius_to_kelvin(20.0)
+        fahrenheit_to_celsius(68.0)
+        fahrenheit_to_kelvin(68.0)
+        kelvin_to_celsius(293.15)
+        kelvin_to_fahrenheit(293.15)
+        celsius_to_fahrenheit!(similar(floats), floats)
+        celsius_to_kelvin!(similar(floats), floats)
+        celsius_to_kelvin!(similar(singles), singles)
+        fahrenheit_to_celsius!(similar(floats), floats)
+        fahrenheit_to_kelvin!(similar(floats), floats)
+        kelvin_to_celsius!(similar(floats), floats)
+        kelvin_to_fahrenheit!(similar(floats), floats)
+        convert_unit(100, Celsius(), Fahrenheit())
+        for unit in (Gram(), Milligram(), MetricTon(), LongTon(), ShortTon(), Pound(), Ounce(), Carat(), AtomicMassUnit())
+            convert_unit(2.0, Kilogram(), unit)
+        end
+        convert_unit!(similar(floats), floats, Kelvin(), Celsius())
+        convert_unit!(similar(floats), floats, conversion(Gram(), Ounce()))
+        weight_conversion("kilogram", "pound", 4)
+        weight_conversion!(similar(floats), "kilogram", "pound", floats)
+    end
+end
@@ -7,5 +7,34 @@ of length at most 1000 nt.
 Return: Four integers (separated by spaces) counting the respective number of times that the symbols 'A', 'C', 'G', and 'T' occur in s
 """
 function count_nucleotides(s::AbstractString)
-	return join(map(y -> count(x -> x == y, s), ['A', 'T', 'G', 'C']), " ")
+	a = c = g = t = 0
+	# one pass over the bytes, the letters are all ASCII
+	for b in codeunits(s)
+		a += b == UInt8('A')
+		c += b == UInt8('C')
+		g += b == UInt8('G')
+		t += b == UInt8('T')
+	end
+	return string(a, " ", t, " ", g, " ", c)
+end
+
+"""
+    count_nucleotides(dna::PackedDNA)
+
+Same counts for a packed sequence, 32 bases at a time (see `nucleotide_counts`).
+"""
+function count_nucleotides(dna::PackedDNA)
+	counts = nucleotide_counts(dna)
+	return string(counts.A, " ", counts.T, " ", counts.G, " ", counts.C)
+end
+
+"""
+    count_nucleotides(reader::FastxReader; ntasks=Threads.nthreads())
+
+Same counts over all the sequences of a FASTA/FASTQ file, counted in parallel
+chunks (see `nucleotide_counts`).
+"""
+function count_nucleotides(reader::FastxReader; ntasks::Integer = Threads.nthreads())
+	counts = nucleotide_counts(reader; ntasks = ntasks)
+	return string(counts.A, " ", counts.T, " ", counts.G, " ", counts.C)
 end
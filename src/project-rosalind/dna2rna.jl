@@ -9,3 +9,10 @@ Return: The transcribed RNA string of t
 function dna2rna(s::AbstractString)
 	return replace(s, 'T' => 'U')
 end
+
+"""
+    dna2rna(dna::PackedDNA)
+
+The transcribed RNA of a packed sequence, as a lazy `PackedRNA` view: nothing is copied.
+"""
+dna2rna(dna::PackedDNA) = PackedRNA(dna)
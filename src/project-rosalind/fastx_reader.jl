@@ -0,0 +1,251 @@
+"""
+    FastxReader(path)
+    FastxReader(bytes::Vector{UInt8})
+
+Reader of a FASTA or FASTQ file (told apart by its first character, `>` or `@`),
+memory mapped with `Mmap` instead of being loaded: the file can be larger than
+the memory, and only the pages being read are brought in by the OS.
+
+Iterating over it gives a `FastxRecord` per record, whose fields are views into
+the file, so no record is copied. FASTQ records are the usual four lines (header,
+sequence, `+`, quality), FASTA sequences may span several lines.
+
+`count_nucleotides`, `nucleotide_counts` and `reverse_complement` take a reader
+too: the file is then split into `ntasks` chunks (`Threads.nthreads()` by
+default) starting on a line or record boundary, processed in parallel, and the
+results of the chunks are combined.
+
+# Example
+
+```julia
+reader = FastxReader("reads.fastq")
+for record in reader
+    println(String(record.identifier), ": ", length(record.sequence), " bases")
+end
+count_nucleotides(reader)   # e.g. "20 21 17 12", counted over all the records
+```
+"""
+struct FastxReader
+    data::Vector{UInt8}
+    format::Symbol # :fasta or :fastq
+end
+
+FastxReader(path::AbstractString) = FastxReader(Mmap.mmap(path))
+
+function FastxReader(data::Vector{UInt8})
+    i = findfirst(b -> !isspace(Char(b)), data)
+    if i === nothing || data[i] == UInt8('>')
+        return FastxReader(data, :fasta)
+    elseif data[i] == UInt8('@')
+        return FastxReader(data, :fastq)
+    end
+    throw(ArgumentError("not a FASTA or FASTQ file, it should start with '>' or '@'"))
+end
+
+const ByteView = SubArray{UInt8,1,Vector{UInt8},Tuple{UnitRange{Int}},true}
+
+"""
+    FastxRecord
+
+A record of a `FastxReader`, as views into its file:
+
+- `identifier`: the header line, without the leading `>` or `@`;
+- `sequence`: the sequence, which still contains the line breaks of a multi-line FASTA
+  record (`sequence(record)` removes them);
+- `quality`: the quality line of a FASTQ record, empty for FASTA.
+"""
+struct FastxRecord
+    identifier::ByteView
+    sequence::ByteView
+    quality::ByteView
+end
+
+"""
+    sequence(record::FastxRecord)
+
+The sequence of `record` as a `String`, without line breaks.
+"""
+sequence(record::FastxRecord) = String(filter(b -> b != 0x0a && b != 0x0d, record.sequence))
+
+Base.IteratorSize(::Type{FastxReader}) = Base.SizeUnknown()
+Base.eltype(::Type{FastxReader}) = FastxRecord
+Base.iterate(reader::FastxReader, pos::Int = 1) = read_record(reader, pos, length(reader.data))
+
+# Last byte of the line starting at i (before "\n" or "\r\n") and first byte of the next line
+@inline function line_bounds(data::Vector{UInt8}, i::Int, hi::Int)
+    e = findnext(isequal(0x0a), data, i)
+    e = e === nothing || e > hi ? hi + 1 : e
+    last = e - 1
+    if last >= i && @inbounds data[last] == 0x0d
+        last -= 1
+    end
+    return last, e + 1
+end
+
+# The record starting at pos (or after the empty lines from pos) and the position after it,
+# nothing if there is no record before hi
+function read_record(reader::FastxReader, pos::Int, hi::Int)
+    data = reader.data
+    while pos <= hi && (data[pos] == 0x0a || data[pos] == 0x0d)
+        pos += 1
+    end
+    pos > hi && return nothing
+    marker = reader.format == :fasta ? UInt8('>') : UInt8('@')
+    data[pos] == marker || throw(ArgumentError("malformed $(reader.format) record at byte $pos"))
+
+    header_last, next = line_bounds(data, pos, hi)
+    identifier = view(data, pos+1:header_last)
+    if reader.format == :fasta
+        first_base = next
+        last_base = next - 1
+        while next <= hi && data[next] != marker
+            line_last, next = line_bounds(data, next, hi)
+            last_base = max(last_base, line_last)
+        end
+        return FastxRecord(identifier, view(data, first_base:last_base), view(data, 1:0)), next
+    end
+
+    sequence_last, plus = line_bounds(data, next, hi)
+    sequence = view(data, next:sequence_last)
+    plus <= hi && data[plus] == UInt8('+') || throw(ArgumentError("malformed fastq record at byte $pos"))
+    _, first_quality = line_bounds(data, plus, hi)
+    quality_last, next = line_bounds(data, first_quality, hi)
+    return FastxRecord(identifier, sequence, view(data, first_quality:quality_last)), next
+end
+
+# Bytes processed by a task at least, smaller files are not split as much
+const FASTX_MIN_CHUNK = 1 << 20
+
+# First line start at or after i
+function line_start(data::Vector{UInt8}, i::Int)
+    (i <= 1 || i > length(data)) && return min(max(i, 1), length(data) + 1)
+    data[i - 1] == 0x0a && return i
+    e = findnext(isequal(0x0a), data, i)
+    return e === nothing ? length(data) + 1 : e + 1
+end
+
+# Char at the start of the line following the line starting at i
+function next_line_starts_with(data::Vector{UInt8}, i::Int, c::Char)
+    _, next = line_bounds(data, i, length(data))
+    return next <= length(data) && data[next] == UInt8(c)
+end
+
+# First record start at or after i. A FASTQ header starts with '@' like some
+# quality lines, but only a header is followed by the '+' line two lines below.
+function record_start(reader::FastxReader, i::Int)
+    data = reader.data
+    i = line_start(data, i)
+    while i <= length(data)
+        if reader.format == :fasta
+            data[i] == UInt8('>') && return i
+        elseif data[i] == UInt8('@')
+            _, next = line_bounds(data, i, length(data))
+            next <= length(data) && next_line_starts_with(data, next, '+') && return i
+        end
+        _, i = line_bounds(data, i, length(data))
+    end
+    return length(data) + 1
+end
+
+# Byte ranges of the chunks, starting on a record boundary (or on a line
+# boundary for FASTA when by_record is false)
+function fastx_chunks(reader::FastxReader, ntasks::Integer, by_record::Bool)
+    data = reader.data
+    n = length(data)
+    ntasks = max(1, min(ntasks, n ÷ FASTX_MIN_CHUNK))
+    starts = Int[1]
+    for k in 1:ntasks-1
+        s = 1 + (n * k) ÷ ntasks
+        s = by_record || reader.format == :fastq ? record_start(reader, s) : line_start(data, s)
+        push!(starts, max(s, last(starts)))
+    end
+    push!(starts, n + 1)
+    return [starts[k]:starts[k+1]-1 for k in 1:ntasks]
+end
+
+# Results of f(reader, chunk) for all the chunks, each one in a task
+function map_chunks(f, reader::FastxReader, ntasks::Integer, by_record::Bool)
+    chunks = fastx_chunks(reader, ntasks, by_record)
+    tasks = [Threads.@spawn f(reader, chunk) for chunk in chunks]
+    return map(fetch, tasks)
+end
+
+# Counts of A, C, G and T (upper or lower case) in data[lo:hi]
+function count_bases(data::Vector{UInt8}, lo::Int, hi::Int)
+    a = c = g = t = 0
+    @inbounds @simd for i in lo:hi
+        b = data[i] & 0xdf # upper case
+        a += b == UInt8('A')
+        c += b == UInt8('C')
+        g += b == UInt8('G')
+        t += b == UInt8('T')
+    end
+    return (A = a, C = c, G = g, T = t)
+end
+
+add_counts(x::NamedTuple, y::NamedTuple) = (A = x.A + y.A, C = x.C + y.C, G = x.G + y.G, T = x.T + y.T)
+
+function chunk_counts(reader::FastxReader, chunk::UnitRange{Int})
+    data = reader.data
+    counts = (A = 0, C = 0, G = 0, T = 0)
+    i = first(chunk)
+    if reader.format == :fasta
+        # chunks start on a line, all the lines but the headers are bases
+        while i <= last(chunk)
+            line_last, next = line_bounds(data, i, last(chunk))
+            if data[i] != UInt8('>')
+                counts = add_counts(counts, count_bases(data, i, line_last))
+            end
+            i = next
+        end
+    else
+        while (next = read_record(reader, i, last(chunk))) !== nothing
+            record, i = next
+            bases = parentindices(record.sequence)[1]
+            counts = add_counts(counts, count_bases(data, first(bases), last(bases)))
+        end
+    end
+    return counts
+end
+
+"""
+    nucleotide_counts(reader::FastxReader; ntasks=Threads.nthreads())
+
+Number of A, C, G and T (upper or lower case) in all the sequences of the file,
+as a named tuple `(A=..., C=..., G=..., T=...)`.
+"""
+function nucleotide_counts(reader::FastxReader; ntasks::Integer = Threads.nthreads())
+    return reduce(add_counts, map_chunks(chunk_counts, reader, ntasks, false))
+end
+
+# Complement of each ASCII letter (the others are kept), preserving the case
+const DNA_COMPLEMENT = let complement = collect(0x00:0xff)
+    for (x, y) in ("AT", "TA", "CG", "GC", "UA", "NN")
+        complement[UInt8(x) + 1] = UInt8(y)
+        complement[UInt8(lowercase(x)) + 1] = UInt8(lowercase(y))
+    end
+    Tuple(complement)
+end
+
+function reverse_complement_bytes(sequence::AbstractVector{UInt8})
+    n = count(b -> b != 0x0a && b != 0x0d, sequence)
+    out = Vector{UInt8}(undef, n)
+    j = n
+    @inbounds for b in sequence
+        if b != 0x0a && b != 0x0d
+            out[j] = DNA_COMPLEMENT[b + 1]
+            j -= 1
+        end
+    end
+    return String(out)
+end
+
+function chunk_reverse_complements(reader::FastxReader, chunk::UnitRange{Int})
+    complements = String[]
+    i = first(chunk)
+    while (next = read_record(reader, i, last(chunk))) !== nothing
+        record, i = next
+        push!(complements, reverse_complement_bytes(record.sequence))
+    end
+    return complements
+end
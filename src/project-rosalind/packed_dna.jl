@@ -0,0 +1,158 @@
+"""
+    PackedDNA(s::AbstractString)
+    PackedDNA(bytes::AbstractVector{UInt8})
+    PackedDNA(words::AbstractVector{UInt64}, n)
+    PackedDNA(packed::Vector{UInt8}, n)
+
+DNA sequence stored with 2 bits per base, 32 bases per `UInt64` word: 4 times
+less memory than a `String`, and kernels working on 32 bases at a time
+(`count_nucleotides`, `reverse_complement`, `dna2rna`).
+
+The first two forms encode the letters of `s` or the ASCII `bytes` (e.g. a line
+read from a FASTA file), upper or lower case, and throw an `ArgumentError` on
+anything else than A, C, G, T (or U). The last two wrap `n` bases already
+packed in `words`, or in the bytes of `packed`, without copying them.
+
+It is an `AbstractVector{Char}`, so it can be indexed and iterated like the
+string, and `String(dna)` decodes it.
+
+# Encoding
+
+Base `i` takes the bits `2(i-1)%64` and `2(i-1)%64 + 1` of the word
+`(i-1) ÷ 32 + 1`, with A = 00, C = 01, T = 10 and G = 11: these are the bits 2
+and 3 of the ASCII codes, and the complement of a base flips the high bit
+(A <-> T, C <-> G). The unused bits of the last word are zeros.
+
+# Example
+
+```julia
+dna = PackedDNA("AAAACCCGGT")
+dna[5]                          # returns 'C'
+String(reverse_complement(dna)) # returns "ACCGGGTTTT"
+```
+"""
+struct PackedDNA{D<:AbstractVector{UInt64}} <: AbstractVector{Char}
+    data::D
+    n::Int
+end
+
+function PackedDNA(words::AbstractVector{UInt64}, n::Integer)
+    length(words) >= cld(n, 32) || throw(ArgumentError("$(length(words)) words cannot hold $n bases"))
+    return PackedDNA{typeof(words)}(words, Int(n))
+end
+
+function PackedDNA(packed::Vector{UInt8}, n::Integer)
+    length(packed) % 8 == 0 || throw(ArgumentError("packed bases must fill whole 8 byte words"))
+    return PackedDNA(reinterpret(UInt64, packed), n)
+end
+
+# 2-bit code of each ASCII letter, 0xff for the others
+const DNA_CODES = let codes = fill(0xff, 256)
+    for (c, code) in zip("ACTGU", (0x00, 0x01, 0x02, 0x03, 0x02))
+        codes[UInt8(c) + 1] = code
+        codes[UInt8(lowercase(c)) + 1] = code
+    end
+    Tuple(codes)
+end
+
+const DNA_LETTERS = ('A', 'C', 'T', 'G')
+const RNA_LETTERS = ('A', 'C', 'U', 'G')
+
+PackedDNA(s::AbstractString) = PackedDNA(codeunits(s))
+
+function PackedDNA(bytes::AbstractVector{UInt8})
+    n = length(bytes)
+    words = Vector{UInt64}(undef, cld(n, 32))
+    offset = firstindex(bytes) - 1
+    bad = 0x00
+    @inbounds for w in eachindex(words)
+        first_base = 32 * (w - 1)
+        word = zero(UInt64)
+        for j in 1:min(32, n - first_base)
+            code = DNA_CODES[bytes[offset + first_base + j] + 1]
+            bad |= code
+            word |= UInt64(code & 0x03) << (2 * (j - 1))
+        end
+        words[w] = word
+    end
+    bad < 0x04 || throw(ArgumentError("not a DNA sequence, only A, C, G, T and U are allowed"))
+    return PackedDNA(words, n)
+end
+
+Base.size(dna::PackedDNA) = (dna.n,)
+
+# 2-bit code of the base i
+@inline function base_code(dna::PackedDNA, i::Int)
+    @inbounds word = dna.data[firstindex(dna.data) + ((i - 1) >> 5)]
+    return (word >> (2 * ((i - 1) & 31))) % UInt8 & 0x03
+end
+
+@inline function Base.getindex(dna::PackedDNA, i::Int)
+    @boundscheck checkbounds(dna, i)
+    return @inbounds DNA_LETTERS[base_code(dna, i) + 1]
+end
+
+Base.String(dna::PackedDNA) = decode(dna, DNA_LETTERS)
+
+function decode(dna::PackedDNA, letters::NTuple{4,Char})
+    bytes = Vector{UInt8}(undef, length(dna))
+    @inbounds for i in eachindex(bytes)
+        bytes[i] = UInt8(letters[base_code(dna, i) + 1])
+    end
+    return String(bytes)
+end
+
+Base.show(io::IO, dna::PackedDNA) = print(io, "PackedDNA(\"", String(dna), "\")")
+Base.show(io::IO, ::MIME"text/plain", dna::PackedDNA) = print(io, length(dna), "-base PackedDNA:\n  ", String(dna))
+
+# The words of dna, a last partial word has its unused bits cleared
+@inline function masked_word(dna::PackedDNA, w::Int)
+    @inbounds word = dna.data[firstindex(dna.data) + w - 1]
+    used = dna.n - 32 * (w - 1)
+    return used >= 32 ? word : word & ((one(UInt64) << (2 * used)) - one(UInt64))
+end
+
+nwords(dna::PackedDNA) = cld(dna.n, 32)
+
+"""
+    nucleotide_counts(dna::PackedDNA)
+
+Number of A, C, G and T in `dna`, as a named tuple `(A=..., C=..., G=..., T=...)`.
+
+For each word, the low and high bits of the 32 bases are taken apart with
+`0x5555...` and their combinations counted with `count_ones` (popcount):
+`lo & ~hi` are the Cs, `hi & ~lo` the Ts, `hi & lo` the Gs, and the rest are As.
+"""
+function nucleotide_counts(dna::PackedDNA)
+    c = t = g = 0
+    @inbounds for w in 1:nwords(dna)
+        word = masked_word(dna, w)
+        lo = word & 0x5555555555555555
+        hi = (word >> 1) & 0x5555555555555555
+        c += count_ones(lo & ~hi)
+        t += count_ones(hi & ~lo)
+        g += count_ones(hi & lo)
+    end
+    return (A = dna.n - c - t - g, C = c, G = g, T = t)
+end
+
+"""
+    PackedRNA(dna::PackedDNA)
+
+RNA transcribed from `dna`, returned by `dna2rna`: a lazy view of the same bits,
+which only reads U instead of T.
+"""
+struct PackedRNA{D} <: AbstractVector{Char}
+    dna::PackedDNA{D}
+end
+
+Base.size(rna::PackedRNA) = size(rna.dna)
+
+@inline function Base.getindex(rna::PackedRNA, i::Int)
+    @boundscheck checkbounds(rna, i)
+    return @inbounds RNA_LETTERS[base_code(rna.dna, i) + 1]
+end
+
+Base.String(rna::PackedRNA) = decode(rna.dna, RNA_LETTERS)
+Base.show(io::IO, rna::PackedRNA) = print(io, "PackedRNA(\"", String(rna), "\")")
+Base.show(io::IO, ::MIME"text/plain", rna::PackedRNA) = print(io, length(rna), "-base PackedRNA:\n  ", String(rna))
@@ -10,3 +10,41 @@ function reverse_complement(s::AbstractString)
 	rules = Dict('A' => 'T', 'T' => 'A', 'G' => 'C', 'C' => 'G')
 	return map(x -> rules[x], reverse(s))
 end
+
+"""
+    reverse_complement(dna::PackedDNA)
+
+Reverse complement of a packed sequence, as a new `PackedDNA`, 32 bases at a time:
+the bases of each word are reversed with a few shifts and a byte swap, and all of
+them complemented by flipping their high bit with one XOR. The words are taken in
+reverse order, shifted to drop the unused bits of the last word.
+"""
+function reverse_complement(dna::PackedDNA)
+	nw = nwords(dna)
+	words = Vector{UInt64}(undef, nw)
+	shift = 2 * (32 * nw - length(dna))
+	@inbounds for k in 1:nw
+		low = reverse_complement_word(dna.data[firstindex(dna.data) + nw - k])
+		high = k < nw ? reverse_complement_word(dna.data[firstindex(dna.data) + nw - k - 1]) : zero(UInt64)
+		# a shift by 64 bits gives 0
+		words[k] = (low >> shift) | (high << (64 - shift))
+	end
+	return PackedDNA(words, length(dna))
+end
+
+@inline function reverse_complement_word(w::UInt64)
+	w = ((w >> 2) & 0x3333333333333333) | ((w & 0x3333333333333333) << 2)
+	w = ((w >> 4) & 0x0f0f0f0f0f0f0f0f) | ((w & 0x0f0f0f0f0f0f0f0f) << 4)
+	return bswap(w) ⊻ 0xaaaaaaaaaaaaaaaa
+end
+
+"""
+    reverse_complement(reader::FastxReader; ntasks=Threads.nthreads())
+
+Reverse complements of all the sequences of a FASTA/FASTQ file, in the order of the
+records, computed in parallel chunks of records. Letters other than A, C, G, T, U
+and N are kept as they are.
+"""
+function reverse_complement(reader::FastxReader; ntasks::Integer = Threads.nthreads())
+	return reduce(vcat, map_chunks(chunk_reverse_complements, reader, ntasks, true))
+end
@@ -14,6 +14,8 @@ process_id = Any[1, 2, 3] # process ids
 burst_times = Any[3, 4, 5] # burst times
 fcfs(n, process_id, burst_times)
 ```
+`Scheduler` simulates FCFS, with arrival times, and the other policies.
+
 # Reference
 
 https://en.wikipedia.org/wiki/Scheduling_(computing)#First_come,_first_served
@@ -21,17 +23,28 @@ https://en.wikipedia.org/wiki/Scheduling_(computing)#First_come,_first_served
 Contributed By:- [Ashwani Rathee](https://github.com/ashwani-rathee)
 """
 function fcfs(n, process_id, burst_time)
-    waiting_time = []
-    push!(waiting_time, 0)
-    for i = 2:n
-        # Calculates waiting time
-        push!(waiting_time, burst_time[i - 1] + waiting_time[i - 1])
-    end
+    # the times have the type of the burst times
+    return fcfs_times!(similar(burst_time, n), similar(burst_time, n), n, process_id, burst_time)
+end
+
+"""
+    fcfs!(ws::Workspace, n, process_id, burst_time)
+
+Same as `fcfs`, with the waiting and turnaround times in vectors of the
+workspace `ws`, which allocates nothing once they have grown to `n` elements.
+"""
+function fcfs!(ws::Workspace, n, process_id, burst_time)
+    T = eltype(burst_time)
+    return fcfs_times!(acquire!(ws, Vector{T}, n), acquire!(ws, Vector{T}, n), n, process_id, burst_time)
+end
 
-    turnaround_time = []
+function fcfs_times!(waiting_time, turnaround_time, n, process_id, burst_time)
+    elapsed = zero(first(burst_time))
     for i = 1:n
-        # Calculates turnaround time
-        push!(turnaround_time, burst_time[i] + waiting_time[i])
+        # Calculates waiting and turnaround times
+        waiting_time[i] = elapsed
+        elapsed += burst_time[i]
+        turnaround_time[i] = elapsed
     end
 
     # Calculates Average waiting time
@@ -0,0 +1,237 @@
+"""
+    FCFS()
+    SJF()
+    SRTF()
+    RoundRobin(quantum)
+    PriorityScheduling(; aging=0)
+
+Scheduling policies for a `Scheduler`:
+
+- `FCFS`: first come, first served;
+- `SJF`: shortest job first, the shortest burst among the ready processes runs to completion;
+- `SRTF`: shortest remaining time first, the preemptive SJF: a process arriving with a
+  shorter burst than what is left of the running one takes its place;
+- `RoundRobin(quantum)`: the ready processes run in turn for at most `quantum`, the
+  processes arriving during a quantum queue up before the one it preempts;
+- `PriorityScheduling(aging=0)`: the ready process with the smallest priority number runs
+  to completion. With `aging > 0`, a waiting process gains a priority level every
+  `aging` time units, so that none of them starves.
+
+Ties go to the process which arrived first.
+"""
+abstract type SchedulingPolicy end
+
+struct FCFS <: SchedulingPolicy end
+struct SJF <: SchedulingPolicy end
+struct SRTF <: SchedulingPolicy end
+struct RoundRobin <: SchedulingPolicy
+    quantum::Int
+    function RoundRobin(quantum::Integer)
+        quantum > 0 || throw(ArgumentError("the quantum must be positive"))
+        return new(quantum)
+    end
+end
+struct PriorityScheduling <: SchedulingPolicy
+    aging::Int
+    function PriorityScheduling(; aging::Integer = 0)
+        aging >= 0 || throw(ArgumentError("aging must be non negative"))
+        return new(aging)
+    end
+end
+
+"""
+    ScheduleResult
+
+Per process times of a simulation, as vectors indexed like the input:
+`start` (first time on the CPU), `completion`, `waiting` (time spent ready but
+not running), `turnaround` (from arrival to completion) and `response` (from
+arrival to start), and `context_switches`, the number of times the CPU went
+from a process to another one.
+"""
+struct ScheduleResult
+    start::Vector{Int}
+    completion::Vector{Int}
+    waiting::Vector{Int}
+    turnaround::Vector{Int}
+    response::Vector{Int}
+    context_switches::Base.RefValue{Int}
+end
+
+ScheduleResult() = ScheduleResult(Int[], Int[], Int[], Int[], Int[], Ref(0))
+
+"""
+    Scheduler()
+
+Simulation engine for CPU scheduling policies. `simulate!(scheduler, policy,
+arrival, burst[, priority])` runs the processes with the arrival times
+`arrival` and the burst times `burst` (and priorities, for
+`PriorityScheduling`) under `policy`, and returns a `ScheduleResult`.
+
+The ready processes are kept in a binary heap, ordered by a key which depends
+on the policy: the arrival for FCFS, the burst for SJF, the remaining time for
+SRTF, the time of queueing for round robin and the priority for priority
+scheduling. Aging only shifts the priorities by the arrival times
+(`priority * aging + arrival`), which keeps their order in the heap. Each
+event (an arrival, a completion or a preemption) costs `O(log(n))`, and the
+heap and the results belong to the scheduler: simulating again with as many
+processes allocates nothing (and nothing at all if the arrivals are sorted).
+
+# Example
+
+```julia
+scheduler = Scheduler()
+result = simulate!(scheduler, SRTF(), [0, 1, 2, 3], [8, 4, 9, 5])
+result.completion             # returns [17, 5, 26, 10]
+average_waiting_time(result)  # returns 6.5
+```
+
+# Reference
+- https://en.wikipedia.org/wiki/Scheduling_(computing)
+"""
+mutable struct Scheduler
+    order::Vector{Int}      # processes sorted by arrival
+    remaining::Vector{Int}  # time left to run, per process
+    heap_keys::Vector{Int}  # ready queue, as a binary heap of (key, rank in order)
+    heap_ranks::Vector{Int}
+    heap_size::Int
+    result::ScheduleResult  # reused by each simulation
+end
+
+Scheduler() = Scheduler(Int[], Int[], Int[], Int[], 0, ScheduleResult())
+
+average_waiting_time(r::ScheduleResult) = sum(r.waiting) / length(r.waiting)
+average_turnaround_time(r::ScheduleResult) = sum(r.turnaround) / length(r.turnaround)
+
+# Heap ordered by key, then by rank
+@inline heap_before(s::Scheduler, i::Int, j::Int) =
+    @inbounds (s.heap_keys[i], s.heap_ranks[i]) < (s.heap_keys[j], s.heap_ranks[j])
+
+@inline function heap_swap!(s::Scheduler, i::Int, j::Int)
+    @inbounds s.heap_keys[i], s.heap_keys[j] = s.heap_keys[j], s.heap_keys[i]
+    @inbounds s.heap_ranks[i], s.heap_ranks[j] = s.heap_ranks[j], s.heap_ranks[i]
+end
+
+function heap_push!(s::Scheduler, key::Int, rank::Int)
+    s.heap_size += 1
+    i = s.heap_size
+    @inbounds s.heap_keys[i] = key
+    @inbounds s.heap_ranks[i] = rank
+    while i > 1 && heap_before(s, i, i >> 1)
+        heap_swap!(s, i, i >> 1)
+        i >>= 1
+    end
+    return s
+end
+
+function heap_pop!(s::Scheduler)
+    rank = @inbounds s.heap_ranks[1]
+    heap_swap!(s, 1, s.heap_size)
+    s.heap_size -= 1
+    i = 1
+    while 2i <= s.heap_size
+        c = 2i
+        c + 1 <= s.heap_size && heap_before(s, c + 1, c) && (c += 1)
+        heap_before(s, c, i) || break
+        heap_swap!(s, i, c)
+        i = c
+    end
+    return rank
+end
+
+# Key of the process p in the ready queue, seq counting the processes queued so far
+ready_key(::FCFS, p, rank, seq, arrival, burst, remaining, priority) = rank
+ready_key(::SJF, p, rank, seq, arrival, burst, remaining, priority) = @inbounds burst[p]
+ready_key(::SRTF, p, rank, seq, arrival, burst, remaining, priority) = @inbounds remaining[p]
+ready_key(::RoundRobin, p, rank, seq, arrival, burst, remaining, priority) = seq
+ready_key(policy::PriorityScheduling, p, rank, seq, arrival, burst, remaining, priority) =
+    @inbounds policy.aging == 0 ? Int(priority[p]) : Int(priority[p]) * policy.aging + Int(arrival[p])
+
+# Time for which the process runs, until the next arrival at most for SRTF
+run_time(::SchedulingPolicy, remaining, t, next_arrival) = remaining
+run_time(policy::RoundRobin, remaining, t, next_arrival) = min(remaining, policy.quantum)
+run_time(::SRTF, remaining, t, next_arrival) = min(remaining, max(next_arrival - t, 1))
+
+"""
+    simulate!(scheduler, policy, arrival, burst[, priority])
+
+Runs the processes `1:n` with the arrival times `arrival`, the burst times
+`burst > 0` and, for `PriorityScheduling`, the priorities `priority` (smaller
+is more urgent) through `policy`, and returns the `ScheduleResult`, which
+belongs to `scheduler` and is overwritten by the next simulation.
+"""
+function simulate!(s::Scheduler, policy::SchedulingPolicy, arrival::AbstractVector{<:Integer},
+        burst::AbstractVector{<:Integer}, priority::Union{AbstractVector{<:Integer},Nothing} = nothing)
+    n = length(arrival)
+    length(burst) == n || throw(DimensionMismatch("$n arrival times but $(length(burst)) burst times"))
+    Base.require_one_based_indexing(arrival, burst)
+    all(b -> b > 0, burst) || throw(ArgumentError("burst times must be positive"))
+    if policy isa PriorityScheduling
+        priority === nothing && throw(ArgumentError("PriorityScheduling needs the priorities"))
+        length(priority) == n || throw(DimensionMismatch("$n arrival times but $(length(priority)) priorities"))
+        Base.require_one_based_indexing(priority)
+    end
+    result = s.result
+    for v in (s.order, s.remaining, s.heap_keys, s.heap_ranks, result.start, result.completion,
+            result.waiting, result.turnaround, result.response)
+        resize!(v, n)
+    end
+    if issorted(arrival)
+        s.order .= 1:n
+    else
+        sortperm!(s.order, arrival)
+    end
+    s.remaining .= burst
+    s.heap_size = 0
+    run_processes!(s, result, policy, arrival, burst, priority)
+    @inbounds for p in 1:n
+        result.turnaround[p] = result.completion[p] - arrival[p]
+        result.waiting[p] = result.turnaround[p] - burst[p]
+        result.response[p] = result.start[p] - arrival[p]
+    end
+    return result
+end
+
+function run_processes!(s::Scheduler, result::ScheduleResult, policy, arrival, burst, priority)
+    n = length(arrival)
+    order, remaining = s.order, s.remaining
+    fill!(result.start, -1)
+    switches = 0
+    t = n == 0 ? 0 : Int(arrival[order[1]])
+    next = 1 # rank of the next process to arrive
+    seq = 0
+    done = 0
+    last = 0
+    @inbounds while done < n
+        if s.heap_size == 0 && arrival[order[next]] > t
+            t = Int(arrival[order[next]]) # idle until then
+        end
+        while next <= n && arrival[order[next]] <= t
+            p = order[next]
+            heap_push!(s, ready_key(policy, p, next, seq += 1, arrival, burst, remaining, priority), next)
+            next += 1
+        end
+        rank = heap_pop!(s)
+        p = order[rank]
+        result.start[p] < 0 && (result.start[p] = t)
+        last != 0 && last != p && (switches += 1)
+        last = p
+        next_arrival = next <= n ? Int(arrival[order[next]]) : typemax(Int)
+        slice = run_time(policy, remaining[p], t, next_arrival)
+        t += slice
+        remaining[p] -= slice
+        # the processes arriving meanwhile queue up before the preempted one
+        while next <= n && arrival[order[next]] <= t
+            q = order[next]
+            heap_push!(s, ready_key(policy, q, next, seq += 1, arrival, burst, remaining, priority), next)
+            next += 1
+        end
+        if remaining[p] == 0
+            result.completion[p] = t
+            done += 1
+        else
+            heap_push!(s, ready_key(policy, p, rank, seq += 1, arrival, burst, remaining, priority), rank)
+        end
+    end
+    result.context_switches[] = switches
+    return result
+end
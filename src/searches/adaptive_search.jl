@@ -0,0 +1,82 @@
+"""
+    AdaptiveIndex(keys; sample=nothing)
+
+Sorted `keys` prepared for `adaptive_search`, which uses whichever of
+`interpolation_search`, `exponential_search` and the branch free `SortedIndex`
+search suits them best. The choice is made once, here, and cached in the
+`strategy` field (`:interpolation`, `:exponential` or `:binary`).
+
+To choose, every strategy runs on a sample of queries while counting the
+keys it probes: `sample` if given (e.g. queries taken from the real
+workload), otherwise 64 keys evenly spread over `keys`. An interpolation
+probe costs about twice a binary one (division, unpredictable accesses), so
+its count is doubled.
+
+- near-uniform keys, like timestamps, take a couple of interpolation probes
+  against `log2(n)` binary ones;
+- skewed keys, like ids with a long tail, can make interpolation search
+  linear, while binary search always stays at `log2(n)`;
+- exponential search takes `2 log2(i)` probes to find the key at index `i`,
+  for queries that mostly hit the first keys.
+
+# Example
+
+```julia
+idx = AdaptiveIndex(collect(1:3:3000))
+idx.strategy            # returns :interpolation
+adaptive_search(idx, 7) # returns 3
+adaptive_search(idx, 8) # returns -1
+```
+"""
+struct AdaptiveIndex{T<:Real}
+    keys::Vector{T}
+    strategy::Symbol
+    sorted::Union{Nothing,SortedIndex{T,Base.Order.ForwardOrdering}} # only for :binary
+end
+
+const ADAPTIVE_SAMPLE_SIZE = 64
+
+function AdaptiveIndex(keys::AbstractVector{T}; sample=nothing) where T <: Real
+    issorted(keys) || throw(ArgumentError("AdaptiveIndex() needs sorted keys"))
+    keys = Vector{T}(keys)
+    n = length(keys)
+    if n > 0 && sample === nothing
+        sample = keys[unique(round.(Int, range(1, n, length=min(n, ADAPTIVE_SAMPLE_SIZE))))]
+    end
+    if n == 0 || isempty(sample)
+        return AdaptiveIndex(keys, :binary, SortedIndex(keys))
+    end
+
+    interpolation = exponential = 0
+    for q in sample
+        interpolation += last(interpolation_search_probes(keys, 1, n, q))
+        exponential += last(exponential_search_probes(keys, q))
+    end
+    # Average probes per query, binary search taking one per level of the Eytzinger tree
+    strategy, cost = :binary, 8 * sizeof(Int) - leading_zeros(n)
+    if exponential / length(sample) < cost
+        strategy, cost = :exponential, exponential / length(sample)
+    end
+    if 2 * interpolation / length(sample) < cost
+        strategy = :interpolation
+    end
+    return AdaptiveIndex(keys, strategy, strategy == :binary ? SortedIndex(keys) : nothing)
+end
+
+"""
+    adaptive_search(idx::AdaptiveIndex, x)
+
+Searches `x` among the keys of `idx` with the strategy chosen for them.
+Returns the index of `x`, or -1 if it is not there.
+"""
+function adaptive_search(idx::AdaptiveIndex, x::Real)
+    keys = idx.keys
+    if idx.strategy == :interpolation
+        return interpolation_search(keys, 1, length(keys), x)
+    elseif idx.strategy == :exponential
+        return exponential_search(keys, x)
+    else
+        i = searchsortedfirst(idx.sorted::SortedIndex, x)
+        return i <= length(keys) && keys[i] == x ? i : -1
+    end
+end
@@ -4,7 +4,7 @@
 # Problem Instructions:
 
 """
-    binary_search(list, query; rev=false, lt=<, by=identity)
+    binary_search(list, query; rev=false, lt=<, by=identity, check_sorted=true)
 
 Implement a binary search algorithm.
 Searching a sorted collection is a common task. A dictionary is a sorted list of word definitions. Given a word, one can find its definition. A telephone book is a sorted list of people's names, addresses, and telephone numbers. Knowing someone's name allows one to quickly find their telephone number and address.
@@ -25,27 +25,38 @@ A binary search halves the number of items to check with each iteration, so loca
 
 Bonus task:
 Implement keyword arguments by, lt and rev so that by specifies a transformation applied to all elements of the list, lt specifies a comparison and rev specifies if the list is ordered in reverse.
-"""
-
-function binary_search(list, query; rev=false, lt=<, by=identity)
-    if issorted(list) || issorted(list, rev=true)
-        low = !rev ? 1 : length(list)
-        high = !rev ? length(list) : 1
-        middle(l, h) = round(Int, (l + h) // 2)
-        query = by(query)
-
-        while !rev ? low <= high : high <= low
-            mid = middle(low, high)
-            by(list[mid]) === query && return mid:mid
-            if lt(by(list[mid]), query)
-                low = !rev ? mid + 1 : mid - 1
-            else
-                high = !rev ? mid - 1 : mid + 1
-            end
-        end
-        return !rev ? (low:high) : (high:low)
 
-    else
+Checking that the list is sorted takes O(n), longer than the search itself: pass `check_sorted=false` when the list is known to be sorted, or build a `SortedIndex` to run many queries against the same keys.
+"""
+function binary_search(list, query; rev=false, lt=<, by=identity, check_sorted::Bool=true)
+    if check_sorted && !issorted(list; lt=lt, by=by, rev=rev)
         throw(error("List not sorted, unable to search value"))
     end
+    o = Base.Order.ord(lt, by, rev)
+
+    # First index whose value is not before query
+    low, high = firstindex(list), lastindex(list)
+    while low <= high
+        mid = (low + high) >>> 1
+        @count probes
+        if Base.Order.lt(o, list[mid], query)
+            low = mid + 1
+        else
+            high = mid - 1
+        end
+    end
+    first_match = low
+
+    # First index whose value is after query
+    high = lastindex(list)
+    while low <= high
+        mid = (low + high) >>> 1
+        @count probes
+        if Base.Order.lt(o, query, list[mid])
+            high = mid - 1
+        else
+            low = mid + 1
+        end
+    end
+    return first_match:(low - 1)
 end
@@ -14,38 +14,60 @@ It works better than Binary Search for bounded arrays, and also when the element
 """
 
 # See Issue https://github.com/TheAlgorithms/Julia/issues/34
-function binary_search(arr::AbstractArray{T,1}, l::T, r::T, x::T) where T <: Real
-	n = size(arr)[1]
-	if (r >= l)
-		mid = Int(ceil(l + (r - l) / 2));
-		# println(mid)
-		if (arr[mid] == x)
-			return "Element present at index $mid"
-		elseif (arr[mid] > x)
-			binary_search(arr, l, mid - 1, x)
+"""
+    binary_search(arr::AbstractVector{<:Real}, l::Integer, r::Integer, x::Real)
+
+Iterative binary search for `x` in the sorted `arr[l:r]`, as used by
+`exponential_search`. Returns the index of `x`, or -1 if it is not there.
+"""
+function binary_search(arr::AbstractVector{<:Real}, l::Integer, r::Integer, x::Real)
+	return first(binary_search_probes(arr, l, r, x))
+end
+
+# binary_search(arr, l, r, x), also returning the number of probed elements
+function binary_search_probes(arr::AbstractVector{<:Real}, l::Integer, r::Integer, x::Real)
+	l, r = Int(l), Int(r)
+	probes = 0
+	while l <= r
+		mid = (l + r) >>> 1
+		probes += 1
+		if arr[mid] == x
+			return mid, probes
+		elseif arr[mid] > x
+			r = mid - 1
 		else
-			binary_search(arr, mid + 1, r, x)
+			l = mid + 1
 		end
-	else
-		return "Element not present in array"
 	end
+	return -1, probes
 end
 
 """
-	 exponential_search(arr::AbstractArray{T,1}, x::T) where {T <: Real}
+	 exponential_search(arr::AbstractVector{<:Real}, x::Real)
 
 Exponential Search in 1-D array
-Time Complexity:  O(Log n)
+Time Complexity:  O(Log i), where i is the index of `x`
+
+Returns the index of `x`, or -1 if it is not in `arr`.
 """
-function exponential_search(arr::AbstractArray{T,1}, x::T) where {T <: Real}
-	n = size(arr)[1]
+function exponential_search(arr::AbstractVector{<:Real}, x::Real)
+	return first(exponential_search_probes(arr, x))
+end
+
+# exponential_search(arr, x), also returning the number of probed elements
+function exponential_search_probes(arr::AbstractVector{<:Real}, x::Real)
+	n = length(arr)
+	n == 0 && return -1, 0
 	if (arr[1] == x)
-		return "Elemenet present at index 1"
+		return 1, 1
 	end
 
 	i = 1
-	while ( i < n && arr[i] <= x)
+	probes = 1
+	while (i < n && arr[i] <= x)
+		probes += 1
 		i = i * 2
 	end
-	return binary_search(arr, Int(ceil(i / 2)), min(i, n), x)
+	index, binary_probes = binary_search_probes(arr, max(i ÷ 2, 1), min(i, n), x)
+	return index, probes + binary_probes
 end
@@ -31,23 +31,41 @@ Rest of the Interpolation algorithm is the same except the above partition logic
 """
 
 """
-	 interpolation_search(arr::AbstractArray{T,1}, l::T, r::T, x::T) where {T <: Real}
+	 interpolation_search(arr::AbstractVector{<:Real}, l::Integer, r::Integer, x::Real)
+	 interpolation_search(arr::AbstractVector{<:Real}, x::Real)
 
-Interpolation Search in 1-D array
-Time Complexity: O(log2(log2 n))
+Interpolation Search in 1-D array, between `l` and `r` (the whole array by default)
+Time Complexity: O(log2(log2 n)) on uniformly distributed keys, O(n) in the worst case
+
+Returns the index of `x`, or -1 if it is not in `arr`.
 """
-function interpolation_search(arr::AbstractArray{T,1}, l::T, r::T, x::T) where {T <: Real}
-	n = size(arr)[1]
-	if (r >= l && x >= arr[l] && x <= arr[r])
-		mid = Int(ceil(l + (((x - arr[l]) * (r - l)) / (arr[r] - arr[l]))))
+function interpolation_search(arr::AbstractVector{<:Real}, l::Integer, r::Integer, x::Real)
+	return first(interpolation_search_probes(arr, l, r, x))
+end
+
+interpolation_search(arr::AbstractVector{<:Real}, x::Real) = interpolation_search(arr, 1, length(arr), x)
+
+# interpolation_search(arr, l, r, x), also returning the number of probed elements
+function interpolation_search_probes(arr::AbstractVector{<:Real}, l::Integer, r::Integer, x::Real)
+	l, r = Int(l), Int(r)
+	probes = 0
+	while (r >= l && x >= arr[l] && x <= arr[r])
+		# All of arr[l:r] is equal to x, the formula below would divide by zero
+		if (arr[l] == arr[r])
+			@count probes
+			return l, probes + 1
+		end
+		# The fraction is in [0, 1], so l <= mid <= r
+		mid = l + floor(Int, (x - arr[l]) / (arr[r] - arr[l]) * (r - l))
+		probes += 1
+		@count probes
 		if (arr[mid] == x)
-			return "Element present at index $mid"
+			return mid, probes
 		elseif (arr[mid] > x)
-			interpolation_search(arr, l, mid - 1, x)
+			r = mid - 1
 		else
-			interpolation_search(arr, mid + 1, r, x)
+			l = mid + 1
 		end
-	else
-		return "Element not present in array"
 	end
+	return -1, probes
 end
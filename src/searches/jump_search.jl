@@ -13,23 +13,30 @@ In the worst case, we have to do n/m jumps and if the last checked value is grea
 """
 
 """
-    jump_search(arr::AbstractArray{T,1}, x::T, jump::T = Int(ceil(sqrt(n)))) where {T <: Real}
+    jump_search(arr::AbstractVector{<:Real}, x::Real, jump::Integer = isqrt(length(arr)))
 Jump Search in 1-D array
 Time Complexity :  O(√ n)
 Time complexity of Jump Search is between Linear Search ( ( O(n) ) and Binary Search ( O (Log n) )
+
+Returns the index of `x`, or -1 if it is not in `arr`.
 """
-function jump_search(arr::AbstractArray{T,1}, x::T, jump::T = Int(ceil(sqrt(n)))) where {T <: Real}
-	n = size(arr)[1];
+function jump_search(arr::AbstractVector{<:Real}, x::Real, jump::Integer = isqrt(length(arr)))
+	n = length(arr)
+	n == 0 && return -1
+	jump = max(Int(jump), 1)
 	start = 1
-	final = jump
+	final = min(jump, n)
+	@count probes
 	while( arr[final] <= x && final < n)
 		start = final
 	 	final = final + jump
 		if( final > n -1)
 		   final = n
 		end
+		@count probes
 	end
 	for i in start:final
+		@count probes
 		if(arr[i] == x)
 			return i
 		end
@@ -0,0 +1,137 @@
+"""
+    SortedIndex(keys; lt=isless, by=identity, rev=false)
+
+Search index over sorted `keys`, for running many queries against the same
+keys. Sortedness is checked once here instead of on every query, and an
+unsorted `keys` throws an `ArgumentError`.
+
+The keys are stored in Eytzinger (breadth-first) order: the root of the
+implicit binary search tree is at 1 and the children of node `k` at `2k` and
+`2k+1`. The first levels of the tree, visited by every query, then share a few
+cache lines, and a lookup is a branch free descent `k = 2k + (key[k] < x)`.
+
+Lookups return indices of `keys`, like their `Base` counterparts:
+`searchsortedfirst(idx, x)`, `searchsortedlast(idx, x)`, `searchsorted(idx, x)`,
+`x in idx`, `binary_search(idx, x)` and the batched `searchsorted_batch!`.
+The index keeps its own copy of the keys.
+
+# Example
+
+```julia
+idx = SortedIndex([1, 3, 3, 7, 9])
+searchsortedfirst(idx, 3)   # returns 2
+searchsortedlast(idx, 3)    # returns 3
+searchsorted(idx, 4)        # returns 4:3
+searchsorted_batch!(zeros(Int, 3), idx, [0, 7, 10])  # returns [1, 4, 6]
+```
+
+# Reference
+- Khuong & Morin, Array Layouts for Comparison-Based Searching -- https://arxiv.org/abs/1509.05053
+"""
+struct SortedIndex{T,O<:Base.Order.Ordering}
+    keys::Vector{T}       # keys in Eytzinger order
+    position::Vector{Int} # position[k] is the index of keys[k] in the sorted input
+    last::Int             # last index of the sorted input
+    order::O
+end
+
+function SortedIndex(keys::AbstractVector{T}; lt=isless, by=identity, rev::Bool=false) where T
+    issorted(keys; lt=lt, by=by, rev=rev) || throw(ArgumentError("SortedIndex() needs sorted keys"))
+    n = length(keys)
+    idx = SortedIndex(Vector{T}(undef, n), Vector{Int}(undef, n), lastindex(keys), Base.Order.ord(lt, by, rev))
+    eytzinger!(idx, keys, firstindex(keys), 1)
+    return idx
+end
+
+# In-order walk of the implicit tree, filling node k and its subtrees from keys[i:end]
+function eytzinger!(idx::SortedIndex, keys::AbstractVector, i::Int, k::Int)
+    if k <= length(idx.keys)
+        i = eytzinger!(idx, keys, i, 2k)
+        idx.keys[k] = keys[i]
+        idx.position[k] = i
+        i = eytzinger!(idx, keys, i + 1, 2k + 1)
+    end
+    return i
+end
+
+Base.length(idx::SortedIndex) = length(idx.keys)
+
+# Descends from node k to a leaf, going right whenever the node is before x.
+# The last node left to the right is the first one not before x: it is found
+# by stripping the trailing right turns (ones) and the last left turn of k.
+@inline function descend_first(idx::SortedIndex, k::Int, x)
+    n = length(idx.keys)
+    while k <= n
+        @inbounds k = 2k + Base.Order.lt(idx.order, idx.keys[k], x)
+    end
+    return k >> (trailing_ones(k) + 1)
+end
+
+# Same as descend_first, for the first node after x
+@inline function descend_last(idx::SortedIndex, k::Int, x)
+    n = length(idx.keys)
+    while k <= n
+        @inbounds k = 2k + !Base.Order.lt(idx.order, x, idx.keys[k])
+    end
+    return k >> (trailing_ones(k) + 1)
+end
+
+@inline function Base.searchsortedfirst(idx::SortedIndex, x)
+    k = descend_first(idx, 1, x)
+    return first_position(idx, k)
+end
+
+@inline function Base.searchsortedlast(idx::SortedIndex, x)
+    k = descend_last(idx, 1, x)
+    return first_position(idx, k) - 1
+end
+
+# Index in the sorted input of node k, one past the end for k == 0
+@inline first_position(idx::SortedIndex, k::Int) = k == 0 ? idx.last + 1 : (@inbounds idx.position[k])
+
+Base.searchsorted(idx::SortedIndex, x) = searchsortedfirst(idx, x):searchsortedlast(idx, x)
+Base.in(x, idx::SortedIndex) = !isempty(searchsorted(idx, x))
+binary_search(idx::SortedIndex, query) = searchsorted(idx, query)
+
+# Queries descending the tree together in searchsorted_batch!
+const SEARCH_BATCH = 8
+
+"""
+    searchsorted_batch!(out, idx::SortedIndex, queries)
+
+Stores `searchsortedfirst(idx, queries[i])` in `out[i]` for every query.
+
+Queries go down the tree in groups of `SEARCH_BATCH`, one level at a time for
+all of them, so the cache misses of a group overlap instead of following each
+other. Nothing is allocated.
+"""
+function searchsorted_batch!(out::AbstractVector{<:Integer}, idx::SortedIndex, queries::AbstractVector)
+    Base.require_one_based_indexing(out, queries)
+    length(out) == length(queries) || throw(DimensionMismatch("out and queries must have the same length"))
+    n = length(idx.keys)
+    # Levels 0 to depth-1 are complete, so they can be walked without checking k <= n
+    depth = n == 0 ? 0 : 8 * sizeof(Int) - leading_zeros(n) - 1
+
+    i = 1
+    while i + SEARCH_BATCH - 1 <= length(queries)
+        ks = ntuple(_ -> 1, Val(SEARCH_BATCH))
+        for _ in 1:depth
+            ks = descend_level(idx, ks, queries, i - 1)
+        end
+        for j in 1:SEARCH_BATCH
+            out[i + j - 1] = first_position(idx, descend_first(idx, ks[j], queries[i + j - 1]))
+        end
+        i += SEARCH_BATCH
+    end
+    for j in i:length(queries)
+        out[j] = searchsortedfirst(idx, queries[j])
+    end
+    return out
+end
+
+# One step down for each of the nodes ks, node ks[j] being on the path of queries[offset + j]
+@inline function descend_level(idx::SortedIndex, ks::NTuple{N,Int}, queries::AbstractVector, offset::Int) where N
+    return ntuple(Val(N)) do j
+        @inbounds 2ks[j] + Base.Order.lt(idx.order, idx.keys[ks[j]], queries[offset + j])
+    end
+end
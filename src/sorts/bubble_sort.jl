@@ -1,13 +1,15 @@
-function BubbleSort!(arr::Vector{T})where T
+function BubbleSort!(arr::AbstractVector{T})where T
     l=length(arr)-1
     while true
         flag=true
         for i in 1:l
+            @count comparisons
             if arr[i]>arr[i+1]
                 flag=false
                 temp=arr[i]
                 arr[i]=arr[i+1]
                 arr[i+1]=temp
+                @count swaps
             end
         end
         if flag return end
@@ -1,11 +1,29 @@
-function InsertionSort!(arr::Vector{T})where T
-    for i in 1:length(arr)-1
-        temp=arr[i+1]
-        j=i
-        while j>0&&arr[j]>temp
+"""
+    InsertionSort!(arr; lt=isless, by=identity, rev=false)
+
+Sorts `arr` in place by insertion sort. `lt`, `by` and `rev` have the same
+meaning as for `sort!`.
+
+`InsertionSort!(arr, lo, hi, order)` sorts only `arr[lo:hi]` for a
+`Base.Order.Ordering`; being the fastest sort on short runs, it is used that way
+by `QuickSort!` and `MergeSort!` once a range is below `INSERTION_SORT_CUTOFF`.
+"""
+function InsertionSort!(arr::AbstractVector; lt=isless, by=identity, rev::Bool=false)
+    return InsertionSort!(arr, firstindex(arr), lastindex(arr), counting(Base.Order.ord(lt, by, rev)))
+end
+
+function InsertionSort!(arr::AbstractVector, lo::Integer, hi::Integer, o::Base.Order.Ordering)
+    for i in lo+1:hi
+        temp=arr[i]
+        j=i-1
+        while j>=lo&&Base.Order.lt(o,temp,arr[j])
             arr[j+1]=arr[j]
             j-=1
         end
         arr[j+1]=temp
     end
+    return arr
 end
+
+# Ranges shorter than this are left to InsertionSort!
+const INSERTION_SORT_CUTOFF = 16
@@ -0,0 +1,77 @@
+"""
+    MergeSort!(arr, buffer=similar(arr, 0); lt=isless, by=identity, rev=false)
+
+Sorts `arr` in place with a stable top-down merge sort, leaving runs shorter
+than `INSERTION_SORT_CUTOFF` to `InsertionSort!`.
+
+Merging needs scratch space for `cld(length(arr), 2)` elements, which is taken
+from `buffer`. A short `Vector` buffer is grown with `resize!`, so passing the
+same buffer to repeated calls makes them allocation free.
+`lt`, `by` and `rev` have the same meaning as for `sort!`.
+
+# Example
+
+```julia
+buffer = Int[]
+x = [3, 5, 1, 4, 2]
+MergeSort!(x, buffer)             # x == [1, 2, 3, 4, 5]
+MergeSort!(x, buffer, rev=true)   # x == [5, 4, 3, 2, 1]
+```
+
+# Reference
+- https://en.wikipedia.org/wiki/Merge_sort
+"""
+function MergeSort!(arr::AbstractVector, buffer::AbstractVector=similar(arr, 0); lt=isless, by=identity, rev::Bool=false)
+    needed = cld(length(arr), 2)
+    if length(buffer) < needed
+        buffer isa Vector || throw(ArgumentError("MergeSort!() needs a buffer of at least $needed elements"))
+        resize!(buffer, needed)
+    end
+    return merge_sort!(arr, firstindex(arr), lastindex(arr), buffer, counting(Base.Order.ord(lt, by, rev)))
+end
+
+function merge_sort!(arr::AbstractVector, lo::Integer, hi::Integer, buffer::AbstractVector, o::Base.Order.Ordering)
+    if hi - lo < INSERTION_SORT_CUTOFF
+        return InsertionSort!(arr, lo, hi, o)
+    end
+    mid = lo + ((hi - lo) >>> 1)
+    merge_sort!(arr, lo, mid, buffer, o)
+    merge_sort!(arr, mid + 1, hi, buffer, o)
+    return merge_runs!(arr, lo, mid, hi, buffer, o)
+end
+
+"""
+    merge_runs!(arr, lo, mid, hi, buffer, o)
+
+Merges the sorted runs `arr[lo:mid]` and `arr[mid+1:hi]` in place, going
+through `buffer`, which must hold at least `mid - lo + 1` elements.
+Equal elements keep their order.
+"""
+function merge_runs!(arr::AbstractVector, lo::Integer, mid::Integer, hi::Integer, buffer::AbstractVector, o::Base.Order.Ordering)
+    # Nothing to do if the runs are already in order
+    (mid < hi && Base.Order.lt(o, arr[mid + 1], arr[mid])) || return arr
+
+    # Move the left run out of the way and merge it back with the right run,
+    # which never gets overwritten before it is read
+    b_lo = firstindex(buffer)
+    b_hi = b_lo + (mid - lo)
+    copyto!(buffer, b_lo, arr, lo, mid - lo + 1)
+    i, j, k = b_lo, mid + 1, lo
+    while i <= b_hi && j <= hi
+        if Base.Order.lt(o, arr[j], buffer[i])
+            arr[k] = arr[j]
+            j += 1
+        else
+            arr[k] = buffer[i]
+            i += 1
+        end
+        k += 1
+    end
+    # Leftovers of the right run are already in place
+    while i <= b_hi
+        arr[k] = buffer[i]
+        i += 1
+        k += 1
+    end
+    return arr
+end
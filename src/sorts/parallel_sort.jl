@@ -0,0 +1,175 @@
+"""
+    ParallelSort!(arr, buffer=similar(arr, 0); ntasks=Threads.nthreads(), lt=isless, by=identity, rev=false)
+
+Sorts `arr` in place on several threads, with a stable parallel merge sort:
+
+1. `arr` is cut into `ntasks` chunks, each one sorted by `MergeSort!` in its
+   own `Threads.@spawn` task;
+2. neighbouring runs are merged pairwise, back and forth between `arr` and
+   `buffer`, until one run is left. Every merge is itself split in two
+   halves around the median of the longer run (found in the other run by
+   binary search), recursively, so a merge round keeps all threads busy and
+   idle threads pick up the pending halves.
+
+`buffer` must hold `length(arr)` elements, a short `Vector` is grown with
+`resize!`; reusing it across calls avoids allocating a copy of the input.
+Inputs too short to be worth splitting are sorted by `MergeSort!` alone.
+`lt`, `by` and `rev` have the same meaning as for `sort!`.
+
+Julia must be started with several threads (`julia -t auto`) for the tasks to
+run in parallel.
+
+# Example
+
+```julia
+buffer = Float64[]
+x = rand(10^7)
+ParallelSort!(x, buffer)    # issorted(x) == true
+```
+"""
+function ParallelSort!(arr::AbstractVector, buffer::AbstractVector=similar(arr, 0); ntasks::Integer=Threads.nthreads(), lt=isless, by=identity, rev::Bool=false)
+    Base.require_one_based_indexing(arr, buffer)
+    n = length(arr)
+    if length(buffer) < n
+        buffer isa Vector || throw(ArgumentError("ParallelSort!() needs a buffer of at least $n elements"))
+        resize!(buffer, n)
+    end
+    o = counting(Base.Order.ord(lt, by, rev))
+    ntasks = min(Int(ntasks), n ÷ PARALLEL_SORT_GRAIN)
+    if ntasks <= 1
+        return merge_sort!(arr, 1, n, buffer, o)
+    end
+
+    # Run c is arr[bounds[c]+1:bounds[c+1]]
+    bounds = [div((c - 1) * n, ntasks) for c in 1:ntasks+1]
+    @section "ParallelSort!/runs" @sync for c in 1:ntasks
+        chunk = bounds[c]+1:bounds[c+1]
+        Threads.@spawn merge_sort!(arr, first(chunk), last(chunk), view(buffer, chunk), o)
+    end
+
+    @section "ParallelSort!/merges" merge_runs!(arr, buffer, bounds, o, ntasks)
+    return arr
+end
+
+# Merges the sorted runs arr[bounds[r]+1:bounds[r+1]] into one, back and forth with buffer
+function merge_runs!(arr::AbstractVector, buffer::AbstractVector, bounds::Vector{Int}, o::Base.Order.Ordering, ntasks::Int)
+    src, dst = arr, buffer
+    while length(bounds) > 2
+        merge_round!(dst, src, bounds, o)
+        bounds = push!(bounds[1:2:end-1], bounds[end])
+        src, dst = dst, src
+    end
+    if src !== arr
+        parallel_copyto!(arr, src, ntasks)
+    end
+    return arr
+end
+
+# Merges above this many elements are split between tasks
+const PARALLEL_SORT_GRAIN = 1 << 14
+
+# Merges the runs of src (delimited by bounds) two by two into dst
+function merge_round!(dst::AbstractVector, src::AbstractVector, bounds::Vector{Int}, o::Base.Order.Ordering)
+    nruns = length(bounds) - 1
+    @sync for r in 1:2:nruns
+        if r == nruns
+            # odd one out, moved over as is
+            Threads.@spawn copyto!(dst, bounds[r] + 1, src, bounds[r] + 1, bounds[r+1] - bounds[r])
+        else
+            Threads.@spawn parallel_merge!(dst, bounds[r] + 1, src, bounds[r] + 1, bounds[r+1], bounds[r+1] + 1, bounds[r+2], o)
+        end
+    end
+    return dst
+end
+
+"""
+    parallel_merge!(dst, d, src, a_lo, a_hi, b_lo, b_hi, o)
+
+Merges the sorted runs `src[a_lo:a_hi]` and `src[b_lo:b_hi]` into `dst`,
+starting at index `d`. Elements of the first run come first among equals.
+"""
+function parallel_merge!(dst::AbstractVector, d::Int, src::AbstractVector, a_lo::Int, a_hi::Int, b_lo::Int, b_hi::Int, o::Base.Order.Ordering)
+    na = a_hi - a_lo + 1
+    nb = b_hi - b_lo + 1
+    if na + nb <= PARALLEL_SORT_GRAIN
+        return serial_merge!(dst, d, src, a_lo, a_hi, b_lo, b_hi, o)
+    end
+    # Put the median m of the longer run in its final place: the elements of
+    # both runs that go before m are merged by a new task, the others by this one
+    if na >= nb
+        am = a_lo + (na >>> 1)
+        bm = lower_bound(src, b_lo, b_hi, src[am], o)
+        dm = d + (am - a_lo) + (bm - b_lo)
+        dst[dm] = src[am]
+        left = Threads.@spawn parallel_merge!(dst, d, src, a_lo, am - 1, b_lo, bm - 1, o)
+        parallel_merge!(dst, dm + 1, src, am + 1, a_hi, bm, b_hi, o)
+    else
+        bm = b_lo + (nb >>> 1)
+        am = upper_bound(src, a_lo, a_hi, src[bm], o)
+        dm = d + (am - a_lo) + (bm - b_lo)
+        dst[dm] = src[bm]
+        left = Threads.@spawn parallel_merge!(dst, d, src, a_lo, am - 1, b_lo, bm - 1, o)
+        parallel_merge!(dst, dm + 1, src, am, a_hi, bm + 1, b_hi, o)
+    end
+    wait(left)
+    return dst
+end
+
+function serial_merge!(dst::AbstractVector, d::Int, src::AbstractVector, a_lo::Int, a_hi::Int, b_lo::Int, b_hi::Int, o::Base.Order.Ordering)
+    i, j = a_lo, b_lo
+    while i <= a_hi && j <= b_hi
+        if Base.Order.lt(o, src[j], src[i])
+            dst[d] = src[j]
+            j += 1
+        else
+            dst[d] = src[i]
+            i += 1
+        end
+        d += 1
+    end
+    for k in i:a_hi
+        dst[d] = src[k]
+        d += 1
+    end
+    for k in j:b_hi
+        dst[d] = src[k]
+        d += 1
+    end
+    return dst
+end
+
+# First index i in lo:hi such that !(v[i] < x), hi + 1 if there is none
+function lower_bound(v::AbstractVector, lo::Int, hi::Int, x, o::Base.Order.Ordering)
+    while lo <= hi
+        m = lo + ((hi - lo) >>> 1)
+        if Base.Order.lt(o, v[m], x)
+            lo = m + 1
+        else
+            hi = m - 1
+        end
+    end
+    return lo
+end
+
+# First index i in lo:hi such that x < v[i], hi + 1 if there is none
+function upper_bound(v::AbstractVector, lo::Int, hi::Int, x, o::Base.Order.Ordering)
+    while lo <= hi
+        m = lo + ((hi - lo) >>> 1)
+        if Base.Order.lt(o, x, v[m])
+            hi = m - 1
+        else
+            lo = m + 1
+        end
+    end
+    return lo
+end
+
+function parallel_copyto!(dst::AbstractVector, src::AbstractVector, ntasks::Int)
+    n = length(dst)
+    @sync for c in 1:ntasks
+        lo = div((c - 1) * n, ntasks)
+        hi = div(c * n, ntasks)
+        Threads.@spawn copyto!(dst, lo + 1, src, lo + 1, hi - lo)
+    end
+    return dst
+end
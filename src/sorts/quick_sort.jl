@@ -0,0 +1,118 @@
+"""
+    QuickSort!(arr; lt=isless, by=identity, rev=false)
+
+Sorts `arr` in place with introsort: quicksort with a median-of-three pivot,
+switching to heapsort when the recursion gets deeper than `2 log2(n)` (so the
+worst case stays O(n log n)) and to `InsertionSort!` on short ranges.
+
+The sort is not stable. `lt`, `by` and `rev` have the same meaning as for `sort!`.
+
+# Example
+
+```julia
+x = [3, 5, 1, 4, 2]
+QuickSort!(x)             # x == [1, 2, 3, 4, 5]
+QuickSort!(x, rev=true)   # x == [5, 4, 3, 2, 1]
+QuickSort!(x, by=abs2)    # x == [1, 2, 3, 4, 5]
+```
+
+# Reference
+- https://en.wikipedia.org/wiki/Introsort
+"""
+function QuickSort!(arr::AbstractVector; lt=isless, by=identity, rev::Bool=false)
+    lo, hi = firstindex(arr), lastindex(arr)
+    depth = 2 * (8 * sizeof(Int) - leading_zeros(max(hi - lo + 1, 1)))
+    return introsort!(arr, lo, hi, depth, counting(Base.Order.ord(lt, by, rev)))
+end
+
+function introsort!(arr::AbstractVector, lo::Integer, hi::Integer, depth::Integer, o::Base.Order.Ordering)
+    while hi - lo >= INSERTION_SORT_CUTOFF
+        if depth == 0
+            return heapsort!(arr, lo, hi, o)
+        end
+        depth -= 1
+        p = partition!(arr, lo, hi, o)
+        # Recurse into the shorter side and loop on the longer one, which keeps the stack O(log n)
+        if p - lo < hi - p
+            introsort!(arr, lo, p - 1, depth, o)
+            lo = p + 1
+        else
+            introsort!(arr, p + 1, hi, depth, o)
+            hi = p - 1
+        end
+    end
+    return InsertionSort!(arr, lo, hi, o)
+end
+
+"""
+    partition!(arr, lo, hi, o)
+
+Partitions `arr[lo:hi]` around the median of its first, middle and last
+elements and returns the final index `p` of that pivot: afterwards no element
+of `arr[lo:p-1]` is greater, and no element of `arr[p+1:hi]` is smaller.
+"""
+function partition!(arr::AbstractVector, lo::Integer, hi::Integer, o::Base.Order.Ordering)
+    mid = lo + ((hi - lo) >>> 1)
+    # Order arr[mid] <= arr[lo] <= arr[hi] so the pivot sits at lo and both
+    # scans below are stopped by a sentinel without bounds checks
+    if Base.Order.lt(o, arr[lo], arr[mid])
+        arr[mid], arr[lo] = arr[lo], arr[mid]
+        @count swaps
+    end
+    if Base.Order.lt(o, arr[hi], arr[lo])
+        if Base.Order.lt(o, arr[hi], arr[mid])
+            arr[hi], arr[lo], arr[mid] = arr[lo], arr[mid], arr[hi]
+            @count swaps 2
+        else
+            arr[hi], arr[lo] = arr[lo], arr[hi]
+            @count swaps
+        end
+    end
+    pivot = arr[lo]
+
+    i, j = lo, hi
+    while true
+        i += 1
+        j -= 1
+        while Base.Order.lt(o, arr[i], pivot)
+            i += 1
+        end
+        while Base.Order.lt(o, pivot, arr[j])
+            j -= 1
+        end
+        i >= j && break
+        arr[i], arr[j] = arr[j], arr[i]
+        @count swaps
+    end
+    arr[j], arr[lo] = pivot, arr[j]
+    @count swaps
+    return j
+end
+
+function heapsort!(arr::AbstractVector, lo::Integer, hi::Integer, o::Base.Order.Ordering)
+    n = hi - lo + 1
+    for i in (n >>> 1):-1:1
+        sift_down!(arr, lo, i, n, o)
+    end
+    for last in n:-1:2
+        arr[lo], arr[lo + last - 1] = arr[lo + last - 1], arr[lo]
+        @count swaps
+        sift_down!(arr, lo, 1, last - 1, o)
+    end
+    return arr
+end
+
+# Moves node i of the max-heap stored (1-based) in arr[lo:lo+n-1] down to its place
+function sift_down!(arr::AbstractVector, lo::Integer, i::Integer, n::Integer, o::Base.Order.Ordering)
+    x = arr[lo + i - 1]
+    while (child = 2i) <= n
+        if child < n && Base.Order.lt(o, arr[lo + child - 1], arr[lo + child])
+            child += 1
+        end
+        Base.Order.lt(o, x, arr[lo + child - 1]) || break
+        arr[lo + i - 1] = arr[lo + child - 1]
+        i = child
+    end
+    arr[lo + i - 1] = x
+    return arr
+end
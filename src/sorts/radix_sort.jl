@@ -0,0 +1,123 @@
+"""
+    RadixSort!(arr; by=identity, rev=false)
+
+Sorts `arr` in place with a stable least-significant-digit radix sort, one
+byte per pass. The keys `by(x)` must be fixed size integers or floats
+(`Int8`...`UInt128`, `Float16`, `Float32`, `Float64`).
+
+Keys are first mapped to unsigned integers with the same order (`radix_key`),
+so a pass never compares anything; passes over a byte that is the same for
+all keys (e.g. the high bytes of small integers) are skipped. Unlike
+`QuickSort!` and `MergeSort!` there is no `lt`: the order is the natural one
+of the keys, where `-0.0` comes before `0.0` and NaNs go to the ends depending
+on their sign bit.
+
+# Example
+
+```julia
+x = [3.0, -5.5, 1.0, 4.0, -2.0]
+RadixSort!(x)                   # x == [-5.5, -2.0, 1.0, 3.0, 4.0]
+RadixSort!(x, rev=true)         # x == [4.0, 3.0, 1.0, -2.0, -5.5]
+RadixSort!(x, by=abs)           # x == [1.0, -2.0, 3.0, 4.0, -5.5]
+```
+
+# Reference
+- https://en.wikipedia.org/wiki/Radix_sort
+"""
+function RadixSort!(arr::AbstractVector; by=identity, rev::Bool=false)
+    n = length(arr)
+    n <= 1 && return arr
+    U = typeof(radix_key(by(first(arr)), rev))
+    keys = Vector{U}(undef, n)
+    for (k, x) in zip(eachindex(keys), arr)
+        keys[k] = radix_key(by(x), rev)
+    end
+
+    if by === identity && eltype(arr) <: RadixKey
+        # The keys are the values: sort them alone and decode them back
+        keys, _ = radix_passes!(keys, similar(keys), nothing, nothing)
+        for (i, k) in zip(eachindex(arr), keys)
+            arr[i] = radix_value(eltype(arr), k, rev)
+        end
+    else
+        values = collect(arr)
+        _, values = radix_passes!(keys, similar(keys), values, similar(values))
+        copyto!(arr, values)
+    end
+    return arr
+end
+
+const RadixKey = Union{Base.BitInteger,Base.IEEEFloat}
+const RADIX_BITS = 8
+const RADIX_MASK = (1 << RADIX_BITS) - 1
+
+"""
+    radix_key(x, rev=false)
+
+Maps `x` to an unsigned integer of the same size, such that the unsigned
+integers are ordered like the `x`s (in reverse when `rev` is set).
+"""
+radix_key(x::RadixKey, rev::Bool) = rev ? ~radix_key(x) : radix_key(x)
+radix_key(x::Base.BitUnsigned) = x
+# Flipping the sign bit moves the negative numbers below the positive ones
+radix_key(x::Base.BitSigned) = unsigned(x) ⊻ (one(unsigned(x)) << (8 * sizeof(x) - 1))
+# Negative floats are ordered backwards by their bits, so flip all of them
+function radix_key(x::Base.IEEEFloat)
+    u = reinterpret(Unsigned, x)
+    signbit = one(u) << (8 * sizeof(u) - 1)
+    return iszero(u & signbit) ? u | signbit : ~u
+end
+
+# Inverse of radix_key
+function radix_value(::Type{T}, u::Unsigned, rev::Bool) where T <: RadixKey
+    rev && (u = ~u)
+    signbit = one(u) << (8 * sizeof(u) - 1)
+    if T <: Unsigned
+        return reinterpret(T, u)
+    elseif T <: Signed
+        return reinterpret(T, u ⊻ signbit)
+    else
+        return reinterpret(T, iszero(u & signbit) ? ~u : u ⊻ signbit)
+    end
+end
+
+"""
+    radix_passes!(keys, keys_tmp, values, values_tmp)
+
+Runs the counting-sort passes over the bytes of `keys`, moving `values` (unless
+it is `nothing`) along. Passes ping-pong between each array and its `_tmp`
+companion, so the sorted keys and values are returned.
+"""
+function radix_passes!(keys::Vector{U}, keys_tmp::Vector{U}, values, values_tmp) where U <: Unsigned
+    npasses = sizeof(U) * 8 ÷ RADIX_BITS
+    # Histograms of all passes, in a single read of the keys
+    counts = zeros(Int, RADIX_MASK + 1, npasses)
+    for k in keys
+        for p in 1:npasses
+            counts[Int((k >> (RADIX_BITS * (p - 1))) & RADIX_MASK) + 1, p] += 1
+        end
+    end
+
+    for p in 1:npasses
+        shift = RADIX_BITS * (p - 1)
+        # Every key has the same digit, the pass would not move anything
+        any(==(length(keys)), view(counts, :, p)) && continue
+        # Turn the counts into the slot before the first one of each digit
+        total = 0
+        for d in 1:RADIX_MASK + 1
+            total, counts[d, p] = total + counts[d, p], total
+        end
+        for i in eachindex(keys)
+            k = keys[i]
+            d = Int((k >> shift) & RADIX_MASK) + 1
+            slot = counts[d, p] += 1
+            keys_tmp[slot] = k
+            values === nothing || (values_tmp[slot] = values[i])
+        end
+        keys, keys_tmp = keys_tmp, keys
+        if values !== nothing
+            values, values_tmp = values_tmp, values
+        end
+    end
+    return keys, values
+end
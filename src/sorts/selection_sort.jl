@@ -1,12 +1,14 @@
-function SelectionSort!(arr::Vector{T})where T
+function SelectionSort!(arr::AbstractVector{T})where T
     l=length(arr)
     for i in 1:l-1
         place=i
         for j in i+1:l
+            @count comparisons
             if arr[j]<arr[place] place=j end
         end
         temp=arr[i]
         arr[i]=arr[place]
         arr[place]=temp
+        @count swaps
     end
 end
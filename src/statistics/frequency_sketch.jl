@@ -0,0 +1,172 @@
+"""
+    CountMinSketch(width=2^14, depth=4; seed=0)
+
+Count-Min sketch: approximate counts of the values of a stream, in a table of
+`depth` rows of `width` counters (rounded up to a power of two). A value adds
+its count to one counter per row, chosen by hashing, and its estimated count
+`sketch[x]` is the smallest of them: never below the true count, and above it
+by at most `2n / width` with probability `1 - 2^-depth` after `n` values.
+
+The rows are indexed by `h1 + row * h2`, from the two halves of a single hash
+of the value. Sketches of the same size and seed are combined with `merge!`.
+
+# Example
+
+```julia
+sketch = CountMinSketch()
+fit!(sketch, rand(1:1000, 10^6))
+sketch[17]    # ≈ 1000
+```
+
+# Reference
+- Cormode & Muthukrishnan, An improved data stream summary: the count-min sketch and its applications (2005)
+- Kirsch & Mitzenmacher, Less hashing, same performance: building a better Bloom filter (2006)
+"""
+struct CountMinSketch
+    counts::Matrix{Int}   # width × depth
+    seed::UInt
+end
+
+function CountMinSketch(width::Integer = 2^14, depth::Integer = 4; seed::Integer = 0)
+    width > 0 && depth > 0 || throw(ArgumentError("the width and depth must be positive"))
+    return CountMinSketch(zeros(Int, nextpow(2, width), depth), UInt(seed))
+end
+
+# Adds c to the counters of x, and returns its new estimated count
+@inline function increment!(s::CountMinSketch, x, c::Int)
+    h = hash(x, s.seed)
+    h1, h2 = h % UInt32, (h >> 32) % UInt32 | 0x1
+    mask = UInt32(size(s.counts, 1) - 1)
+    estimate = typemax(Int)
+    @inbounds for row in 1:size(s.counts, 2)
+        i = Int((h1 + UInt32(row) * h2) & mask) + 1
+        s.counts[i, row] += c
+        estimate = min(estimate, s.counts[i, row])
+    end
+    return estimate
+end
+
+fit!(s::CountMinSketch, x, c::Integer = 1) = (increment!(s, x, Int(c)); s)
+
+function fit!(s::CountMinSketch, xs::AbstractArray)
+    for x in xs
+        increment!(s, x, 1)
+    end
+    return s
+end
+
+function Base.getindex(s::CountMinSketch, x)
+    h = hash(x, s.seed)
+    h1, h2 = h % UInt32, (h >> 32) % UInt32 | 0x1
+    mask = UInt32(size(s.counts, 1) - 1)
+    estimate = typemax(Int)
+    @inbounds for row in 1:size(s.counts, 2)
+        estimate = min(estimate, s.counts[Int((h1 + UInt32(row) * h2) & mask) + 1, row])
+    end
+    return estimate
+end
+
+nobs(s::CountMinSketch) = sum(view(s.counts, :, 1))
+
+function Base.merge!(a::CountMinSketch, b::CountMinSketch)
+    size(a.counts) == size(b.counts) && a.seed == b.seed ||
+        throw(ArgumentError("only sketches of the same size and seed can be merged"))
+    a.counts .+= b.counts
+    return a
+end
+
+"""
+    HeavyHitters{T}(k; width=2^14, depth=4)
+
+The `k` most frequent values of type `T` of a stream, approximately, in
+constant memory: a `CountMinSketch` estimates the counts and the `k` values of
+largest estimate so far are kept in a min-heap, which a new value enters if
+its estimate beats the smallest. With `n` values in all, any value seen more
+than `n / k` times plus the error of the sketch is among them.
+
+Values are added with `fit!`; `topk` returns the candidates and their
+estimated counts, most frequent first, and `mode` the most frequent ones.
+
+# Example
+
+```julia
+h = HeavyHitters{Int}(10)
+fit!(h, [rand() < 0.5 ? rand(1:3) : rand(1:10^6) for _ in 1:10^6])
+topk(h)[1:3]   # 1, 2 and 3, about 166667 times each, in some order
+```
+"""
+mutable struct HeavyHitters{T}
+    k::Int
+    sketch::CountMinSketch
+    items::Vector{T}      # candidates, as a min-heap by count
+    counts::Vector{Int}
+    position::Dict{T,Int} # index of each candidate in the heap
+end
+
+function HeavyHitters{T}(k::Integer; width::Integer = 2^14, depth::Integer = 4) where T
+    k > 0 || throw(ArgumentError("k must be positive"))
+    return HeavyHitters{T}(k, CountMinSketch(width, depth), T[], Int[], Dict{T,Int}())
+end
+
+function fit!(h::HeavyHitters, x)
+    c = increment!(h.sketch, x, 1)
+    i = get(h.position, x, 0)
+    if i != 0
+        h.counts[i] = c
+        heap_sift_down!(h, i)
+    elseif length(h.items) < h.k
+        push!(h.items, x)
+        push!(h.counts, c)
+        h.position[x] = length(h.items)
+        heap_sift_up!(h, length(h.items))
+    elseif c > h.counts[1]
+        delete!(h.position, h.items[1])
+        h.items[1] = x
+        h.counts[1] = c
+        h.position[x] = 1
+        heap_sift_down!(h, 1)
+    end
+    return h
+end
+
+function fit!(h::HeavyHitters, xs::AbstractArray)
+    for x in xs
+        fit!(h, x)
+    end
+    return h
+end
+
+function heap_swap!(h::HeavyHitters, i::Int, j::Int)
+    h.items[i], h.items[j] = h.items[j], h.items[i]
+    h.counts[i], h.counts[j] = h.counts[j], h.counts[i]
+    h.position[h.items[i]] = i
+    h.position[h.items[j]] = j
+end
+
+function heap_sift_up!(h::HeavyHitters, i::Int)
+    while i > 1 && h.counts[i] < h.counts[i >> 1]
+        heap_swap!(h, i, i >> 1)
+        i >>= 1
+    end
+end
+
+function heap_sift_down!(h::HeavyHitters, i::Int)
+    n = length(h.counts)
+    while 2i <= n
+        c = 2i
+        c + 1 <= n && h.counts[c + 1] < h.counts[c] && (c += 1)
+        h.counts[c] < h.counts[i] || break
+        heap_swap!(h, i, c)
+        i = c
+    end
+end
+
+nobs(h::HeavyHitters) = nobs(h.sketch)
+
+topk(h::HeavyHitters) = sort!([x => c for (x, c) in zip(h.items, h.counts)]; by = last, rev = true)
+
+function mode(h::HeavyHitters)
+    isempty(h.counts) && return eltype(h.items)[]
+    top = maximum(h.counts)
+    return [x for (x, c) in zip(h.items, h.counts) if c == top]
+end
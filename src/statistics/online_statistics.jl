@@ -0,0 +1,261 @@
+"""
+    Moments{T}()
+    Moments(x)
+
+Online mean and variance of a stream of numbers, in one pass and constant memory.
+
+Values are added with `fit!`, one at a time or a chunk at a time, and two
+accumulators filled separately (e.g. one per thread or per file) are combined
+with `merge`/`merge!`. The result is then read with `mean`, `variance` and
+`nobs`. `Moments(x)` is `fit!(Moments{float(eltype(x))}(), x)`.
+
+Only the count, the mean and the sum of squared deviations `m2` are kept, and
+updated with Welford's recurrence for a single value:
+
+- n += 1; d = x - mean; mean += d / n; m2 += d * (x - mean)
+
+and with Chan's formula to combine two accumulators A and B:
+
+- d = mean_B - mean_A
+- mean = mean_A + d * n_B / n
+- m2 = m2_A + m2_B + d^2 * n_A * n_B / n
+
+Unlike `sum(x.^2) - n * mean^2`, neither cancels catastrophically. A chunk is
+split in halves down to `PAIRWISE_BLOCK` values, each block is summed in two
+passes and the halves are combined with Chan's formula: like pairwise
+summation, the rounding error then grows with `log(n)` instead of `n`.
+
+# Example
+
+```julia
+acc = Moments{Float64}()
+for chunk in Iterators.partition(1:10, 3)
+    fit!(acc, chunk)
+end
+mean(acc)      # returns 5.5
+variance(acc)  # ≈ 9.1667, the (n - 1) sample variance
+
+merge(Moments(1:5), Moments(6:10)) # same statistics as Moments(1:10)
+```
+
+# References
+- Welford, Note on a Method for Calculating Corrected Sums of Squares and Products (1962)
+- Chan, Golub & LeVeque, Algorithms for computing the sample variance (1979)
+- https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
+"""
+mutable struct Moments{T<:AbstractFloat}
+    n::Int
+    mean::T
+    m2::T
+end
+
+Moments{T}() where T = Moments{T}(0, zero(T), zero(T))
+Moments(x) = fit!(Moments{float(eltype(x))}(), x)
+
+"""
+    CoMoments{T}()
+    CoMoments(x, y)
+
+Online statistics of a stream of pairs `(x, y)`: means, variances, covariance,
+Pearson correlation (`pearson_correlation`) and the simple least squares line
+`y = intercept + slope * x` (`linear_fit`).
+
+It works like `Moments`, adding the sum of the products of the deviations
+`cxy`, which takes the same updates: `cxy += dx * (y - mean_y)` for one pair,
+then `cxy = cxy_A + cxy_B + dx * dy * n_A * n_B / n` to combine two of them.
+"""
+mutable struct CoMoments{T<:AbstractFloat}
+    n::Int
+    mean_x::T
+    mean_y::T
+    m2_x::T
+    m2_y::T
+    cxy::T
+end
+
+CoMoments{T}() where T = CoMoments{T}(0, zero(T), zero(T), zero(T), zero(T), zero(T))
+CoMoments(x, y) = fit!(CoMoments{float(promote_type(eltype(x), eltype(y)))}(), x, y)
+
+# Chunks of at most PAIRWISE_BLOCK values are summed directly
+const PAIRWISE_BLOCK = 128
+
+"""
+    fit!(acc, x)
+    fit!(acc, x, y)
+
+Adds the value `x` (the pair `(x, y)` for a `CoMoments`) to the accumulator
+`acc`, or all the values of the vector `x`. A vector is processed in `ntasks`
+tasks, 1 by default, whose results are merged. Returns `acc`.
+"""
+function fit!(acc::Moments{T}, x::Real) where T
+    acc.n += 1
+    d = x - acc.mean
+    acc.mean += d / acc.n
+    acc.m2 += d * (x - acc.mean)
+    return acc
+end
+
+function fit!(acc::CoMoments{T}, x::Real, y::Real) where T
+    acc.n += 1
+    dx = x - acc.mean_x
+    dy = y - acc.mean_y
+    acc.mean_x += dx / acc.n
+    acc.mean_y += dy / acc.n
+    acc.m2_x += dx * (x - acc.mean_x)
+    acc.m2_y += dy * (y - acc.mean_y)
+    acc.cxy += dx * (y - acc.mean_y)
+    return acc
+end
+
+function fit!(acc::Moments{T}, x::AbstractVector; ntasks::Integer=1) where T
+    return merge!(acc, chunk_stats(Moments{T}, ntasks, firstindex(x), lastindex(x), x))
+end
+
+function fit!(acc::CoMoments{T}, x::AbstractVector, y::AbstractVector; ntasks::Integer=1) where T
+    length(x) == length(y) || throw(DimensionMismatch("x and y must have the same length"))
+    Base.require_one_based_indexing(x, y)
+    return merge!(acc, chunk_stats(CoMoments{T}, ntasks, 1, length(x), x, y))
+end
+
+# Other iterables (ranges are vectors), one value at a time
+function fit!(acc::Moments, x)
+    for v in x
+        fit!(acc, v)
+    end
+    return acc
+end
+
+# Statistics of data[lo:hi], split over ntasks tasks
+function chunk_stats(::Type{S}, ntasks::Integer, lo::Int, hi::Int, data...) where S
+    if ntasks <= 1 || hi - lo < 2 * PAIRWISE_BLOCK
+        return pairwise_stats(S, lo, hi, data...)
+    end
+    mid = (lo + hi) >>> 1
+    left = Threads.@spawn chunk_stats(S, cld(ntasks, 2), lo, mid, data...)
+    right = chunk_stats(S, ntasks ÷ 2, mid + 1, hi, data...)
+    return merge!(fetch(left)::S, right)
+end
+
+function pairwise_stats(::Type{S}, lo::Int, hi::Int, data...) where S
+    if hi - lo < PAIRWISE_BLOCK
+        return block_stats(S, lo, hi, data...)
+    end
+    mid = (lo + hi) >>> 1
+    return merge!(pairwise_stats(S, lo, mid, data...), pairwise_stats(S, mid + 1, hi, data...))
+end
+
+# Two passes over a block: the mean, then the squared deviations from it
+function block_stats(::Type{Moments{T}}, lo::Int, hi::Int, x::AbstractVector) where T
+    n = hi - lo + 1
+    n <= 0 && return Moments{T}()
+    s = zero(T)
+    @inbounds @simd for i in lo:hi
+        s += T(x[i])
+    end
+    m = s / n
+    m2 = zero(T)
+    @inbounds @simd for i in lo:hi
+        m2 += (T(x[i]) - m)^2
+    end
+    return Moments{T}(n, m, m2)
+end
+
+function block_stats(::Type{CoMoments{T}}, lo::Int, hi::Int, x::AbstractVector, y::AbstractVector) where T
+    n = hi - lo + 1
+    n <= 0 && return CoMoments{T}()
+    sx = sy = zero(T)
+    @inbounds @simd for i in lo:hi
+        sx += T(x[i])
+        sy += T(y[i])
+    end
+    mx, my = sx / n, sy / n
+    m2x = m2y = cxy = zero(T)
+    @inbounds @simd for i in lo:hi
+        dx = T(x[i]) - mx
+        dy = T(y[i]) - my
+        m2x += dx * dx
+        m2y += dy * dy
+        cxy += dx * dy
+    end
+    return CoMoments{T}(n, mx, my, m2x, m2y, cxy)
+end
+
+"""
+    merge!(a, b)
+
+Adds the values seen by the accumulator `b` to `a`, as if they had been
+passed to `fit!(a, ...)`. Returns `a`.
+"""
+function Base.merge!(a::Moments, b::Moments)
+    n = a.n + b.n
+    n == 0 && return a
+    d = b.mean - a.mean
+    a.mean += d * (b.n / n)
+    a.m2 += b.m2 + d^2 * (a.n * (b.n / n))
+    a.n = n
+    return a
+end
+
+function Base.merge!(a::CoMoments, b::CoMoments)
+    n = a.n + b.n
+    n == 0 && return a
+    dx = b.mean_x - a.mean_x
+    dy = b.mean_y - a.mean_y
+    w = a.n * (b.n / n)
+    a.mean_x += dx * (b.n / n)
+    a.mean_y += dy * (b.n / n)
+    a.m2_x += b.m2_x + dx^2 * w
+    a.m2_y += b.m2_y + dy^2 * w
+    a.cxy += b.cxy + dx * dy * w
+    a.n = n
+    return a
+end
+
+"""
+    merge(a, b)
+
+New accumulator holding the values of both `a` and `b`.
+"""
+Base.merge(a::Moments, b::Moments) = merge!(copy(a), b)
+Base.merge(a::CoMoments, b::CoMoments) = merge!(copy(a), b)
+
+Base.copy(a::Moments{T}) where T = Moments{T}(a.n, a.mean, a.m2)
+Base.copy(a::CoMoments{T}) where T = CoMoments{T}(a.n, a.mean_x, a.mean_y, a.m2_x, a.m2_y, a.cxy)
+
+"""
+    nobs(acc)
+
+Number of values (or pairs) added to the accumulator `acc`.
+"""
+nobs(acc::Union{Moments,CoMoments}) = acc.n
+
+mean(acc::Moments) = acc.n == 0 ? oftype(acc.mean, NaN) : acc.mean
+
+"""
+    variance(acc::Moments; corrected=true)
+
+Variance of the values added to `acc`, the sample variance (divided by `n - 1`)
+unless `corrected` is false.
+"""
+variance(acc::Moments; corrected::Bool=true) = acc.m2 / (acc.n - corrected)
+
+"""
+    covariance(acc::CoMoments; corrected=true)
+
+Covariance of the pairs added to `acc`, divided by `n - 1` unless `corrected`
+is false.
+"""
+covariance(acc::CoMoments; corrected::Bool=true) = acc.cxy / (acc.n - corrected)
+
+pearson_correlation(acc::CoMoments) = acc.cxy / sqrt(acc.m2_x * acc.m2_y)
+
+"""
+    linear_fit(acc::CoMoments)
+
+Least squares line through the pairs added to `acc`, as `(intercept, slope)`:
+`slope = cov(x, y) / var(x)` and the line passes through the means.
+"""
+function linear_fit(acc::CoMoments)
+    slope = acc.cxy / acc.m2_x
+    return acc.mean_y - slope * acc.mean_x, slope
+end
@@ -1,15 +1,169 @@
-# TODO: doc is missing
+"""
+    OLSSolver{T}(p)
+    OLSSolver(p)
 
-OLSbeta(y,x) = inv(x' * x) * (x' * y)
+Ordinary (or weighted) least squares with `p` regressors, fitted from batches of
+rows without ever holding the whole design matrix `X`: only the `p x p` normal
+matrix `X'X` and the vector `X'y` are kept, so the memory does not depend on the
+number of rows. `T` is `Float64` by default.
 
-# TODO: make it a doctest string
-# a = [10, 14,17,21,20, 18, 42, 51, 77, 11, 91]
-# b = [0.11,0.7,0.2,0.19,0.09,0.8, 0.71,0.1, 0.6,0.3,0.81]
-# OLSbeta(a,b)
+- `fit!(solver, X, y)` adds the rows of `X` with their responses `y`, and
+  `fit!(solver, X, y, w)` the same rows with the weights `w` (any number of
+  batches, weighted or not);
+- `coef!(β, solver)` solves `X'X β = X'y` into `β`, `coef(solver)` into a new
+  vector;
+- `empty!(solver)` forgets all the rows.
 
-# df = DataFrame(a=a, b=b)
-# ols = GLM.lm(@formula(a~b), df)
-# coef(ols) # print coefficients
+The normal equations are solved with a Cholesky factorization, which is the
+fastest. If it fails, or if it shows that a regressor is (almost) a linear
+combination of the others, the solver falls back to a QR factorization with
+column pivoting, and the coefficients of the redundant regressors are set to
+zero. For a model with an intercept, add a column of ones to `X`.
 
-# # Predict
-# predict(ols) # predict the model
+# Example
+
+```julia
+solver = OLSSolver(2)
+for batch in 1:10                                  # e.g. chunks read from disk
+    x = rand(1000)
+    fit!(solver, [ones(1000) x], 3 .+ 2 .* x)
+end
+coef(solver)                                       # returns [3.0, 2.0], up to rounding
+```
+"""
+mutable struct OLSSolver{T}
+    xtx::Matrix{T}    # X'X (or X'WX)
+    xty::Vector{T}    # X'y (or X'Wy)
+    factor::Matrix{T} # scratch space for the factorizations
+    n::Int            # number of rows
+end
+
+OLSSolver{T}(p::Integer) where T = OLSSolver{T}(zeros(T, p, p), zeros(T, p), zeros(T, p, p), 0)
+OLSSolver(p::Integer) = OLSSolver{Float64}(p)
+
+function Base.empty!(s::OLSSolver)
+    fill!(s.xtx, 0)
+    fill!(s.xty, 0)
+    s.n = 0
+    return s
+end
+
+nobs(s::OLSSolver) = s.n
+
+function check_rows(s::OLSSolver, X::AbstractMatrix, y::AbstractVector)
+    size(X, 2) == length(s.xty) || throw(DimensionMismatch("X has $(size(X, 2)) columns, the solver $(length(s.xty)) regressors"))
+    size(X, 1) == length(y) || throw(DimensionMismatch("X has $(size(X, 1)) rows but y has $(length(y)) values"))
+end
+
+function fit!(s::OLSSolver{T}, X::AbstractMatrix, y::AbstractVector) where T
+    check_rows(s, X, y)
+    mul!(s.xtx, X', X, true, true)
+    mul!(s.xty, X', y, true, true)
+    s.n += size(X, 1)
+    return s
+end
+
+function fit!(s::OLSSolver{T}, X::AbstractMatrix, y::AbstractVector, w::AbstractVector) where T
+    check_rows(s, X, y)
+    length(w) == length(y) || throw(DimensionMismatch("y has $(length(y)) values but w has $(length(w))"))
+    Base.require_one_based_indexing(X, y, w)
+    p = length(s.xty)
+    @inbounds for k in 1:p
+        for j in 1:k
+            acc = zero(T)
+            @simd for i in axes(X, 1)
+                acc += w[i] * X[i,j] * X[i,k]
+            end
+            s.xtx[j,k] += acc
+            j != k && (s.xtx[k,j] += acc)
+        end
+        acc = zero(T)
+        @simd for i in axes(X, 1)
+            acc += w[i] * X[i,k] * y[i]
+        end
+        s.xty[k] += acc
+    end
+    s.n += size(X, 1)
+    return s
+end
+
+# One row x with its response y, a rank-1 update which allocates nothing
+fit!(s::OLSSolver, x::AbstractVector, y::Real) = fit!(s, x, y, true)
+
+function fit!(s::OLSSolver{T}, x::AbstractVector, y::Real, w::Real) where T
+    p = length(s.xty)
+    length(x) == p || throw(DimensionMismatch("x has $(length(x)) values, the solver $p regressors"))
+    Base.require_one_based_indexing(x)
+    @inbounds for k in 1:p
+        wx = w * x[k]
+        for j in 1:k
+            s.xtx[j,k] += wx * x[j]
+            j != k && (s.xtx[k,j] += wx * x[j])
+        end
+        s.xty[k] += wx * y
+    end
+    s.n += 1
+    return s
+end
+
+"""
+    coef!(β, solver::OLSSolver)
+
+Least squares coefficients of the rows added to `solver`, stored in `β`.
+Nothing is allocated unless the fallback to QR is needed.
+"""
+function coef!(β::AbstractVector, s::OLSSolver{T}) where T
+    p = length(s.xty)
+    length(β) == p || throw(DimensionMismatch("β must have $p elements"))
+    p == 0 && return β
+    copyto!(s.factor, s.xtx)
+    C = cholesky!(Symmetric(s.factor, :U), check=false)
+    # U[i,i]^2 / X'X[i,i] is the squared sine of the angle between the column i
+    # of X and the previous ones, a small value means they are nearly collinear
+    if issuccess(C) && all(i -> s.factor[i,i]^2 > sqrt(eps(real(T))) * s.xtx[i,i], 1:p)
+        copyto!(β, s.xty)
+        return ldiv!(C, β)
+    end
+    return qr_coef!(β, s)
+end
+
+coef(s::OLSSolver{T}) where T = coef!(Vector{T}(undef, length(s.xty)), s)
+
+const QR_PIVOT = VERSION >= v"1.7" ? LinearAlgebra.ColumnNorm() : Val(true)
+
+# Rank revealing solve: the regressors whose pivots are negligible get no weight
+function qr_coef!(β::AbstractVector, s::OLSSolver{T}) where T
+    copyto!(s.factor, s.xtx)
+    F = qr!(s.factor, QR_PIVOT)
+    z = lmul!(F.Q', copy(s.xty))
+    R = F.R
+    tol = sqrt(eps(real(T))) * abs(R[1,1])
+    r = count(i -> abs(R[i,i]) > tol, 1:length(z))
+    ldiv!(UpperTriangular(view(R, 1:r, 1:r)), view(z, 1:r))
+    z[r+1:end] .= 0
+    β[F.p] = z
+    return β
+end
+
+"""
+    OLSbeta(y, x)
+
+Least squares coefficients of the regression of `y` on the columns of `x`
+(a scalar if `x` is a vector), without intercept: the solution of
+`x'x β = x'y`, computed by an `OLSSolver`.
+
+# Example
+
+```julia
+a = [10, 14, 17, 21, 20, 18, 42, 51, 77, 11, 91]
+b = [0.11, 0.7, 0.2, 0.19, 0.09, 0.8, 0.71, 0.1, 0.6, 0.3, 0.81]
+OLSbeta(a, b)                     # regression through the origin
+OLSbeta(a, [ones(length(b)) b])   # regression with an intercept
+```
+"""
+function OLSbeta(y, x::AbstractMatrix)
+    s = OLSSolver{float(promote_type(eltype(x), eltype(y)))}(size(x, 2))
+    return coef(fit!(s, x, y))
+end
+
+OLSbeta(y, x::AbstractVector) = only(OLSbeta(y, reshape(x, :, 1)))
@@ -8,6 +8,9 @@ Find the pearson correlation between two variables.
 julia> PearsonCorrelation([12,11,16,17,19,21],[11,51,66,72,12,15])
 -0.2092706263573845
 
+The deviations from the means are summed on the fly, without temporary arrays.
+For data streamed in chunks, see `CoMoments`.
+
 Contribution by: [Aru Bhardwaj](https://github.com/arubhardwaj)
 
 
@@ -16,8 +19,8 @@ Contribution by: [Aru Bhardwaj](https://github.com/arubhardwaj)
 function pearson_correlation(x, y)
     mean_x = sum(x) / length(x)
     mean_y = sum(y) / length(y)
-    XY = (x .- mean_x) .* (y .- mean_y)
-    XXs = sum((x .- mean_x) .* (x .- mean_x))
-    YYs = sum((y .- mean_y) .* (y .- mean_y))
-    return(sum(XY) / (sqrt(XXs .* YYs)))
+    XY = sum(i -> (x[i] - mean_x) * (y[i] - mean_y), eachindex(x, y))
+    XXs = sum(i -> (x[i] - mean_x) * (x[i] - mean_x), eachindex(x))
+    YYs = sum(i -> (y[i] - mean_y) * (y[i] - mean_y), eachindex(y))
+    return(XY / (sqrt(XXs .* YYs)))
 end
@@ -0,0 +1,111 @@
+"""
+    P2Quantile(p)
+    P2Quantile{T}(p)
+
+Online estimate of the quantile of order `p` of a stream of numbers, in
+constant memory, by the P² algorithm: five markers track the minimum, the
+quantiles of order `p / 2`, `p` and `(1 + p) / 2` and the maximum. Each value
+moves the markers' positions, and a marker which drifts from its desired
+position by one or more is adjusted by piecewise parabolic (or, failing that,
+linear) interpolation of its neighbours.
+
+Values are added with `fit!` and the estimate is read with `quantile`. It is
+exact up to 5 values.
+
+# Example
+
+```julia
+q = P2Quantile(0.5)
+fit!(q, randn(10^6))
+quantile(q)    # ≈ 0, the median
+```
+
+# Reference
+- Jain & Chlamtac, The P² algorithm for dynamic calculation of quantiles and
+  histograms without storing observations (1985)
+"""
+mutable struct P2Quantile{T<:AbstractFloat}
+    p::T
+    n::Int
+    heights::Vector{T}    # values of the markers
+    positions::Vector{Int}
+    desired::Vector{T}    # desired positions of the markers
+end
+
+function P2Quantile{T}(p::Real) where T
+    0 <= p <= 1 || throw(ArgumentError("the order of a quantile must be in [0, 1]"))
+    p = T(p)
+    return P2Quantile{T}(p, 0, zeros(T, 5), collect(1:5), T[1, 1 + 2p, 1 + 4p, 3 + 2p, 5])
+end
+
+P2Quantile(p::Real) = P2Quantile{Float64}(p)
+
+function fit!(q::P2Quantile{T}, x::Real) where T
+    x = T(x)
+    h, pos, desired = q.heights, q.positions, q.desired
+    q.n += 1
+    if q.n <= 5
+        # the first values, kept sorted
+        i = q.n
+        while i > 1 && h[i - 1] > x
+            h[i] = h[i - 1]
+            i -= 1
+        end
+        h[i] = x
+        return q
+    end
+    # cell k of x, the extreme markers following x
+    if x < h[1]
+        h[1] = x
+        k = 1
+    elseif x >= h[5]
+        h[5] = x
+        k = 4
+    else
+        k = 1
+        while x >= h[k + 1]
+            k += 1
+        end
+    end
+    for i in k+1:5
+        pos[i] += 1
+    end
+    p = q.p
+    desired[2] += p / 2
+    desired[3] += p
+    desired[4] += (1 + p) / 2
+    desired[5] += 1
+    # move the middle markers by one position if they drift
+    for i in 2:4
+        d = desired[i] - pos[i]
+        if (d >= 1 && pos[i + 1] - pos[i] > 1) || (d <= -1 && pos[i - 1] - pos[i] < -1)
+            s = d >= 1 ? 1 : -1
+            parabolic = h[i] + s / (pos[i + 1] - pos[i - 1]) *
+                ((pos[i] - pos[i - 1] + s) * (h[i + 1] - h[i]) / (pos[i + 1] - pos[i]) +
+                 (pos[i + 1] - pos[i] - s) * (h[i] - h[i - 1]) / (pos[i] - pos[i - 1]))
+            if h[i - 1] < parabolic < h[i + 1]
+                h[i] = parabolic
+            else
+                h[i] += s * (h[i + s] - h[i]) / (pos[i + s] - pos[i])
+            end
+            pos[i] += s
+        end
+    end
+    return q
+end
+
+function fit!(q::P2Quantile, xs)
+    for x in xs
+        fit!(q, x)
+    end
+    return q
+end
+
+nobs(q::P2Quantile) = q.n
+
+function quantile(q::P2Quantile)
+    q.n == 0 && return oftype(q.p, NaN)
+    q.n > 5 && return q.heights[3]
+    # exact, from the sorted values
+    return quantile!(q.heights[1:q.n], q.p)
+end
@@ -1,8 +1,19 @@
-# TODO: doc is missing
+"""
+    variance(a)
 
+Sample variance of the numbers in `a`: the sum of their squared deviations from
+the mean, divided by `length(a) - 1`.
+
+Computed in one pass with a `Moments` accumulator, which stays accurate when the
+mean is large compared to the spread (unlike `sum(a.^2) - n * mean^2`).
+
+# Example
+
+```julia
+variance(1:10)        # returns 9.166666666666666
+variance([2, 4, 6])   # returns 4.0
+```
+"""
 function variance(a)
-    avg = a / length(a)
-    x = sum(a - avg)
-    s_sq = x / (length(a) - 1)
-    return(s_sq)
+    return variance(Moments(a))
 end
@@ -1,14 +1,156 @@
 """
-    is_palindrome(s)
-A set of functions to check if a given string
-is a palindrome.
+    is_palindrome(s; ignore_case=false, ignore_punctuation=false)
+    is_palindrome(xs::AbstractVector)
 
-Arguments:
- - s - a string =#
+Whether the string `s` reads the same forwards and backwards, ignoring the
+case of its letters and the characters which are neither letters nor digits
+if asked. The vector method compares elements, such as the `codeunits` of a
+string.
+
+Two indices move towards each other from both ends, without a reversed or
+cleaned copy of `s`. A `String` or a `SubString` of one is compared a byte at
+a time while both sides are ASCII, and by characters from the first
+non-ASCII one.
+
+`map_predicate(is_palindrome, xs)` checks a vector of strings in several tasks.
+
+# Example
+
+```julia
+is_palindrome("racecar")                                  # returns true
+is_palindrome("Racecar")                                  # returns false
+is_palindrome("Racecar"; ignore_case = true)              # returns true
+is_palindrome("A man, a plan, a canal: Panama!"; ignore_case = true, ignore_punctuation = true)   # returns true
+is_palindrome.(["abba", "abc", "été"])                    # returns Bool[1, 0, 1]
+findall(map_predicate(s -> is_palindrome(s; ignore_case = true), split("Anna saw Otto")))   # returns [1, 3]
+```
 """
+function is_palindrome(s::AbstractString; ignore_case::Bool = false, ignore_punctuation::Bool = false)
+    i, j = firstindex(s), lastindex(s)
+    if s isa Union{String,SubString{String}}
+        same, i, j = ascii_palindrome(codeunits(s), 1, ncodeunits(s), ignore_case, ignore_punctuation)
+        same || return false
+        i < j || return true
+        # the byte j is in a character ending further
+        j = thisind(s, j)
+    end
+    while i < j
+        c, d = s[i], s[j]
+        if ignore_punctuation
+            if !is_alphanumeric(c)
+                i = nextind(s, i)
+                continue
+            elseif !is_alphanumeric(d)
+                j = prevind(s, j)
+                continue
+            end
+        end
+        if ignore_case
+            c, d = lowercase(c), lowercase(d)
+        end
+        c == d || return false
+        i, j = nextind(s, i), prevind(s, j)
+    end
+    return true
+end
 
-function is_palindrome(s) # Named function
-    s == reverse(s)
+function is_palindrome(xs::AbstractVector)
+    i, j = firstindex(xs), lastindex(xs)
+    @inbounds while i < j
+        xs[i] == xs[j] || return false
+        i += 1
+        j -= 1
+    end
+    return true
 end
 
-s -> s == reverse(s) # Anonymous
+# Compares the bytes i and j of a string, moving inwards until they differ or
+# one of them is not ASCII, and returns whether no pair differed and where it stopped
+function ascii_palindrome(bytes::AbstractVector{UInt8}, i::Int, j::Int, ignore_case::Bool, ignore_punctuation::Bool)
+    @inbounds while i < j
+        x, y = bytes[i], bytes[j]
+        (x | y) < 0x80 || break
+        if ignore_punctuation
+            if !is_ascii_alphanumeric(x)
+                i += 1
+                continue
+            elseif !is_ascii_alphanumeric(y)
+                j -= 1
+                continue
+            end
+        end
+        if ignore_case
+            x, y = ascii_lowercase(x), ascii_lowercase(y)
+        end
+        x == y || return false, i, j
+        i += 1
+        j -= 1
+    end
+    return true, i, j
+end
+
+is_alphanumeric(c::AbstractChar) = isletter(c) || isnumeric(c)
+is_ascii_alphanumeric(b::UInt8) = (0x30 <= b <= 0x39) | (0x41 <= (b & 0xdf) <= 0x5a)
+ascii_lowercase(b::UInt8) = 0x41 <= b <= 0x5a ? b | 0x20 : b
+
+"""
+    longest_palindrome(s)
+
+The longest substring of `s` which is a palindrome, the first one if several
+are as long, as a `SubString` of `s`. Manacher's algorithm finds it in linear
+time, from the radii of the palindromes centred on each character and between
+each pair of them, each radius starting from that of its mirror in the
+longest palindrome found so far. An ASCII string is scanned as bytes and any
+other one as a vector of its characters.
+
+# Example
+
+```julia
+longest_palindrome("forgeeksskeegfor")   # returns "geeksskeeg"
+longest_palindrome("abacdfgdcaba")       # returns "aba"
+```
+
+# Reference
+- Manacher, A new linear-time "on-line" algorithm for finding the smallest initial palindrome of a string (1975)
+"""
+function longest_palindrome(s::AbstractString)
+    if s isa Union{String,SubString{String}} && isascii(s)
+        start, len = manacher(codeunits(s))
+        return SubString(s, start, start + len - 1)
+    end
+    start, len = manacher(collect(s))
+    len == 0 && return SubString(s, 1, 0)
+    i = nextind(s, 0, start)
+    return SubString(s, i, nextind(s, i, len - 1))
+end
+
+# First index and length of the longest palindrome of x, which is one-based
+function manacher(x::AbstractVector)
+    n = length(x)
+    n == 0 && return 1, 0
+    best_start, best_len = 1, 1
+    # x[i-k+1:i+k-1] is the longest palindrome of odd length centred on i
+    radius = Vector{Int}(undef, n)
+    l, r = 1, 0
+    @inbounds for i in 1:n
+        k = i > r ? 1 : min(radius[l + r - i], r - i + 1)
+        while i - k >= 1 && i + k <= n && x[i - k] == x[i + k]
+            k += 1
+        end
+        radius[i] = k
+        i + k - 1 > r && ((l, r) = (i - k + 1, i + k - 1))
+        2k - 1 > best_len && ((best_start, best_len) = (i - k + 1, 2k - 1))
+    end
+    # x[i-k:i+k-1] is the longest palindrome of even length centred before i
+    l, r = 1, 0
+    @inbounds for i in 1:n
+        k = i > r ? 0 : min(radius[l + r - i + 1], r - i + 1)
+        while i - k - 1 >= 1 && i + k <= n && x[i - k - 1] == x[i + k]
+            k += 1
+        end
+        radius[i] = k
+        i + k - 1 > r && ((l, r) = (i - k, i + k - 1))
+        2k > best_len && ((best_start, best_len) = (i - k, 2k))
+    end
+    return best_start, best_len
+end
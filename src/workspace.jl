@@ -0,0 +1,88 @@
+"""
+    Workspace()
+
+Scratch arrays and dictionaries, kept between calls so that functions run
+many times allocate nothing once they have warmed it up: `acquire!` hands
+out the next unused buffer of a type, emptied or resized, and `reset!`
+makes all of them available again, keeping their memory, as a bump
+allocator would.
+
+The `!` methods of `fcfs`, `mode`, `prime_factors`, `collatz_sequence`,
+`lu_decompose`, `zero_one_pack` and `complete_pack` which take a workspace
+return buffers of it: they are valid until the workspace is reset and the
+buffers handed out again. A workspace is for one task at a time;
+`task_workspace()` returns one of the current task.
+
+# Example
+
+```julia
+ws = Workspace()
+for n in 1:10^6
+    reset!(ws)
+    factors = prime_factors!(ws, n)   # allocates nothing after the first calls
+end
+```
+"""
+struct Workspace
+    pools::Dict{Type,Any} # A => (k, buffers::Vector{A}), with used[k] of them handed out
+    used::Vector{Int}
+end
+
+Workspace() = Workspace(Dict{Type,Any}(), Int[])
+
+"""
+    acquire!(ws::Workspace, Vector{T}, n=0)
+    acquire!(ws::Workspace, Matrix{T}, m, n)
+    acquire!(ws::Workspace, D) where D <: AbstractDict
+    acquire!(ws::Workspace, LUWorkspace{T}, n)
+
+The next unused buffer of the type in `ws`: a vector of `n` elements, a
+matrix of size `m × n`, an empty dictionary or an `LUWorkspace` for `n × n`
+matrices. Vectors keep their capacity, and matrices and LU workspaces are
+allocated again only if the size changes. The elements of arrays are left as
+they were.
+"""
+acquire!(ws::Workspace, ::Type{A}) where A = acquire_buffer!(ws, A, ())
+acquire!(ws::Workspace, ::Type{A}, n::Integer) where A = acquire_buffer!(ws, A, (Int(n),))
+acquire!(ws::Workspace, ::Type{A}, m::Integer, n::Integer) where A = acquire_buffer!(ws, A, (Int(m), Int(n)))
+
+function acquire_buffer!(ws::Workspace, ::Type{A}, dims::Tuple) where A
+    entry = get(ws.pools, A, nothing)
+    if entry === nothing
+        push!(ws.used, 0)
+        entry = (length(ws.used), A[])
+        ws.pools[A] = entry
+    end
+    k, buffers = entry::Tuple{Int,Vector{A}}
+    i = ws.used[k] += 1
+    if i > length(buffers)
+        push!(buffers, new_buffer(A, dims))
+    else
+        buffers[i] = reuse_buffer!(buffers[i], dims)
+    end
+    return buffers[i]
+end
+
+new_buffer(::Type{Vector{T}}, dims::Tuple{}) where T = Vector{T}()
+new_buffer(::Type{Vector{T}}, (n,)::Tuple{Int}) where T = Vector{T}(undef, n)
+new_buffer(::Type{Matrix{T}}, (m, n)::Tuple{Int,Int}) where T = Matrix{T}(undef, m, n)
+new_buffer(::Type{D}, dims::Tuple{}) where D<:AbstractDict = D()
+
+reuse_buffer!(v::Vector, dims::Tuple{}) = empty!(v)
+reuse_buffer!(v::Vector, (n,)::Tuple{Int}) = resize!(v, n)
+reuse_buffer!(x::Matrix{T}, (m, n)::Tuple{Int,Int}) where T = size(x) == (m, n) ? x : Matrix{T}(undef, m, n)
+reuse_buffer!(d::AbstractDict, dims::Tuple{}) = empty!(d)
+
+"""
+    reset!(ws::Workspace)
+
+Makes all the buffers of `ws` available to `acquire!` again. Returns `ws`.
+"""
+reset!(ws::Workspace) = (fill!(ws.used, 0); ws)
+
+"""
+    task_workspace()
+
+The `Workspace` of the current task, created on its first use.
+"""
+task_workspace() = get!(Workspace, task_local_storage(), :TheAlgorithmsWorkspace)::Workspace
@@ -143,4 +143,47 @@
         @test kelvin_to_fahrenheit(273.15) == 32.0
         @test kelvin_to_fahrenheit(300) == 80.33
     end
+
+    @testset "Conversions: Unit Conversions" begin
+        @test convert_unit(100, Celsius(), Fahrenheit()) ≈ 212
+        @test convert_unit(-40.0, Fahrenheit(), Celsius()) ≈ -40
+        @test convert_unit(0.0, Kelvin(), Fahrenheit()) ≈ -459.67
+        @test convert_unit(2, Pound(), Kilogram()) ≈ 0.907184
+        @test convert_unit(4, Kilogram(), Pound()) == weight_conversion("kilogram", "pound", 4)
+        @test_throws MethodError conversion(Celsius(), Pound())
+
+        # chained conversions fuse into one affine map
+        c = conversion(Kelvin(), Fahrenheit()) ∘ conversion(Celsius(), Kelvin())
+        @test c isa UnitConversion{Float64}
+        @test c.scale ≈ 9 / 5 && c.offset ≈ 32
+        @test inv(c)(212.0) ≈ 100
+
+        rng = MersenneTwister(24)
+        for T in (Float32, Float64)
+            x = rand(rng, T, 1001) .* 100
+            out = similar(x)
+            @test celsius_to_kelvin!(out, x) === out
+            @test eltype(out) == T
+            @test out ≈ x .+ T(273.15)
+            for (f!, f) in (
+                (celsius_to_fahrenheit!, celsius_to_fahrenheit),
+                (fahrenheit_to_celsius!, fahrenheit_to_celsius),
+                (fahrenheit_to_kelvin!, fahrenheit_to_kelvin),
+                (kelvin_to_celsius!, kelvin_to_celsius),
+                (kelvin_to_fahrenheit!, kelvin_to_fahrenheit),
+            )
+                @test f!(out, x) ≈ f.(x, 10) rtol = sqrt(eps(T))
+            end
+            # in place
+            y = copy(x)
+            kelvin_to_celsius!(y, celsius_to_kelvin!(y, y))
+            @test y ≈ x
+        end
+        @test_throws DimensionMismatch celsius_to_kelvin!(zeros(2), zeros(3))
+
+        x = [1.0, 10.0, 100.0]
+        @test weight_conversion!(similar(x), "gram", "kilogram", x) ≈ [0.001, 0.01, 0.1]
+        @test weight_conversion!(similar(x), "pound", "ounce", x) ≈ weight_conversion.("pound", "ounce", x)
+        @test_throws ErrorException weight_conversion!(similar(x), "gram", "stone", x)
+    end
 end
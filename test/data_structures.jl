@@ -18,6 +18,38 @@
         @test ch(tree,1,true) == 3
         @test tree.val[left(tree)] == 50
         @test height(tree) == 2
+        @test collect(preorder(tree)) == [1,2,4,3]
+        @test collect(inorder(tree)) == [4,2,1,3]
+        @test collect(postorder(tree)) == [4,2,3,1]
+        @test collect(levelorder(tree)) == [1,2,3,4]
+        @test length(inorder(tree)) == 4
+
+        # the arrays grow past the size given, values need not be numbers
+        tree=BinaryTree{String}(1,"root")
+        for i in 1:1000
+            insert!(tree,i,"node $i")
+        end
+        @test tree.n == 1001
+        @test eltype(tree.par) == Int32
+        @test height(tree) == 1000
+        @test left(tree) == 1001
+        @test tree.val[right(tree)] == "root"
+        @test depth(tree,1001) == 1000
+        @test collect(postorder(tree)) == 1001:-1:1
+
+        tree=BinaryTree(collect(1:10))
+        @test [tree.val[i] for i in inorder(tree)] == 1:10
+        @test collect(levelorder(tree)) == 1:10
+        @test height(tree) == 3
+        @test tree.par[5] == 2 && tree.lch[5] == 10 && tree.rch[5] == 0
+
+        tree=BinaryTree(collect(1:15))
+        @test compact!(tree) === tree
+        @test tree.val == [8,4,12,2,1,3,6,5,7,10,9,11,14,13,15]
+        @test [tree.val[i] for i in inorder(tree)] == 1:15
+        @test all(i -> tree.lch[tree.par[i]] == i || tree.rch[tree.par[i]] == i, 2:15)
+        @test height(tree) == 3
+        @test_throws ArgumentError BinaryTree(Int[])
     end
     @testset "DisjointSet: DisjointSet" begin
         set=DisjointSet(10)
@@ -28,6 +60,119 @@
         @test find(set,2) == 1
         merge!(set,5,4)
         @test find(set,5) == find(set,2)
+
+        set = DisjointSet(5)
+        @test num_sets(set) == 5
+        @test merge!(set, [(1, 2), (3, 4), (2, 4)]) === set
+        @test find(set, 1) == find(set, 3)
+        @test find(set, 5) == 5
+        @test set_size(set, 1) == 4
+        @test set_size(set, 5) == 1
+        @test num_sets(set) == 2
+        @test merge!(set, 1, 3) == find(set, 4) # already merged
+        @test num_sets(set) == 2
+
+        # a long chain does not overflow the stack
+        n = 10^6
+        set = DisjointSet(n)
+        for i in 1:n-1
+            set.par[i] = i + 1
+        end
+        @test find(set, 1) == n
+        @test find(set, 1) == n
+    end
+
+    @testset "DisjointSet: ConcurrentDisjointSet" begin
+        n = 10^4
+        rng = MersenneTwister(17)
+        edges = [(rand(rng, 1:n), rand(rng, 1:n)) for _ in 1:n]
+        reference = merge!(DisjointSet(n), edges)
+        set = ConcurrentDisjointSet(n)
+        @test merge!(set, edges; ntasks = 4) === set
+        @test num_sets(set) == num_sets(reference)
+        @test all(find(set, x) == find(set, y) for (x, y) in edges)
+        @test all((find(set, i) == find(set, 1)) == (find(reference, i) == find(reference, 1)) for i in 1:n)
+        @test merge!(set, edges[1]...) == false
+
+        # enough edges for every task to get some, racing on the same roots
+        n = 10^5
+        edges = [(rand(rng, 1:100), rand(rng, 1:n)) for _ in 1:4n]
+        reference = merge!(DisjointSet(n), edges)
+        for ntasks in (2, 8)
+            set = merge!(ConcurrentDisjointSet(n), edges; ntasks = ntasks)
+            @test num_sets(set) == num_sets(reference)
+            @test all(find(set, x) == find(set, y) for (x, y) in edges)
+            @test all(i -> set.par[i] >= i, 1:n)
+        end
+    end
+end
+@testset "OrderedIndex" begin
+    @testset "OrderedIndex: insert!, get, delete!" begin
+        index = OrderedIndex{Int,String}()
+        for (k, v) in [(5, "five"), (1, "one"), (3, "three")]
+            index[k] = v
+        end
+        @test length(index) == 3
+        @test index[3] == "three"
+        @test get(index, 4, "none") == "none"
+        @test haskey(index, 5) && !haskey(index, 2)
+        @test_throws KeyError index[2]
+        @test collect(index) == [1 => "one", 3 => "three", 5 => "five"]
+        @test collect(scan(index, 2, 5)) == [3 => "three", 5 => "five"]
+        @test kth(index, 1) == (1 => "one")
+        @test searchsortedfirst(index, 4) == 3
+        @test searchsortedlast(index, 3) == 2
+        index[3] = "THREE"
+        @test length(index) == 3 && index[3] == "THREE"
+        delete!(index, 3)
+        delete!(index, 4)
+        @test collect(index) == [1 => "one", 5 => "five"]
+        @test_throws BoundsError kth(index, 3)
+
+        # random operations against a Dict, enough to split and merge nodes on several levels
+        rng = MersenneTwister(19)
+        index = OrderedIndex{Int,Int}()
+        reference = Dict{Int,Int}()
+        for _ in 1:20000
+            k = rand(rng, 1:5000)
+            if rand(rng) < 0.6
+                index[k] = 2k
+                reference[k] = 2k
+            else
+                delete!(index, k)
+                delete!(reference, k)
+            end
+        end
+        sorted = sort(collect(reference))
+        @test length(index) == length(reference)
+        @test height(index) >= 1
+        @test collect(index) == sorted
+        @test all(get(index, k, nothing) == get(reference, k, nothing) for k in 0:5001)
+        @test all(kth(index, i) == sorted[i] for i in eachindex(sorted))
+        ks = first.(sorted)
+        @test all(searchsortedfirst(index, x) == searchsortedfirst(ks, x) for x in 0:5001)
+        @test all(searchsortedlast(index, x) == searchsortedlast(ks, x) for x in 0:5001)
+        @test collect(scan(index, 1000, 2000)) == filter(p -> 1000 <= p.first <= 2000, sorted)
+        @test isempty(collect(scan(index, 6000, 7000)))
+    end
+
+    @testset "OrderedIndex: bulk loading" begin
+        sorted_keys = collect(1:3:30000)
+        index = OrderedIndex(sorted_keys, string.(sorted_keys))
+        @test length(index) == length(sorted_keys)
+        @test collect(index) == [k => string(k) for k in sorted_keys]
+        @test index[2998] == "2998"
+        @test !haskey(index, 2999)
+        @test kth(index, 1000) == (sorted_keys[1000] => string(sorted_keys[1000]))
+        for k in sorted_keys[1:2:end]
+            delete!(index, k)
+        end
+        @test first.(collect(index)) == sorted_keys[2:2:end]
+        index = OrderedIndex(10:-1:1, (10:-1:1) .^ 2; rev = true)
+        @test first(index) == (10 => 100)
+        @test collect(scan(index, 5, 3)) == [5 => 25, 4 => 16, 3 => 9]
+        @test_throws ArgumentError OrderedIndex([1, 3, 2], [1, 2, 3])
+        @test_throws ArgumentError OrderedIndex([1, 1], [1, 2])
     end
 end
 end
@@ -0,0 +1,82 @@
+using Distributed
+
+# The master process alone, then two workers
+addprocs(2; exeflags = "--project=$(Base.active_project())")
+@everywhere using TheAlgorithms
+
+@testset "Distributed" begin
+    rng = MersenneTwister(30)
+
+    @testset "Distributed: ShardedVector" begin
+        x = rand(rng, 1000)
+        s = ShardedVector(x)
+        @test length(s.shards) == 2
+        @test length(s) == 1000 && eltype(s) == Float64
+        @test collect(s) == x
+        @test mapreduce_shards(maximum, max, s) == maximum(x)
+        @test collect(map_shards(y -> 2y, s)) == 2x
+        @test collect(ShardedVector(r -> collect(r), 10; pool = [myid()])) == 1:10
+        @test collect(ShardedVector(r -> collect(r), 10)) == 1:10
+        @test_throws ArgumentError ShardedVector(r -> r[1] == 1 ? Int[] : Float64[], 10)
+    end
+
+    @testset "Distributed: distributed_sort" begin
+        for pool in ([myid()], workers())
+            x = rand(rng, 1:100, 10^4)
+            @test distributed_sort(x; pool = pool) == sort(x)
+            @test distributed_sort(x; pool = pool, rev = true) == sort(x; rev = true)
+            @test distributed_sort(Int[]; pool = pool) == Int[]
+        end
+        s = distributed_sort(ShardedVector(r -> rand(length(r)), 10^5); oversampling = 16)
+        @test length(s) == 10^5
+        @test issorted(collect(s))
+        @test maximum(s.lengths) < 0.6 * 10^5
+        words = [randstring(rng, 3) for _ in 1:1000]
+        @test distributed_sort(words; by = reverse) == sort(words; by = reverse)
+    end
+
+    @testset "Distributed: primes" begin
+        @test collect(distributed_primes(1000)) == PrimeTable(1000).primes
+        @test collect(distributed_primes(10^6)) == PrimeTable(10^6).primes
+        @test collect(distributed_primes(2)) == [2]
+        @test length(distributed_primes(1)) == 0
+        @test distributed_prime_count(10^7) == 664579
+        @test distributed_prime_count(10^7; pool = [myid()]) == 664579
+        @test distributed_prime_count(1) == 0
+        @test distributed_prime_count(3) == 2
+    end
+
+    @testset "Distributed: distributed_fit" begin
+        x, y = randn(rng, 10^5), randn(rng, 10^5)
+        acc = Moments{Float64}()
+        m = distributed_fit(acc, ShardedVector(x))
+        @test nobs(acc) == 0
+        @test nobs(m) == 10^5
+        @test mean(m) ≈ mean(x)
+        @test variance(m) ≈ variance(x)
+
+        m = distributed_fit(acc, r -> x[r], length(x); block_size = 1000)
+        @test mean(m) ≈ mean(x) && variance(m) ≈ variance(x)
+        c = distributed_fit(CoMoments{Float64}(), r -> (x[r], y[r]), length(x); block_size = 4096)
+        @test pearson_correlation(c) ≈ pearson_correlation(x, y)
+        @test_throws ArgumentError distributed_fit(acc, r -> x[r], length(x); block_size = 0)
+
+        ints = rand(rng, 1:10, 1000)
+        sketch = distributed_fit(CountMinSketch(64, 2), ShardedVector(ints))
+        @test nobs(sketch) == 1000
+        @test all(k -> sketch[k] >= count(==(k), ints), 1:10)
+    end
+
+    @testset "Distributed: distributed_knapsack" begin
+        sweep = ((capacity, [1, 3, 11], [2, 5, 30]) for capacity in 0:40)
+        results = distributed_knapsack(sweep; batch_size = 8)
+        @test length(results) == 41
+        @test results[21] == (37, [1, 1, 1])
+        solver = KnapsackSolver()
+        @test results == [(v, copy(t)) for (v, t) in (knapsack!(solver, i...) for i in sweep)]
+        @test distributed_knapsack([(10, [1, 3, 11], [20, 5, 80], [2, 2, 1])])[1] == knapsack!(solver, 10, [1, 3, 11], [20, 5, 80], [2, 2, 1])
+        @test isempty(distributed_knapsack(()))
+    end
+end
+
+rmprocs(workers())
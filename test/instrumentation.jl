@@ -0,0 +1,91 @@
+@testset "Instrumentation: off by default" begin
+    reset_instrumentation!()
+    QuickSort!(rand(100))
+    binary_search(1:100, 5)
+    @test all(iszero, instrumentation_counts())
+    @test isempty(instrumentation_sections())
+end
+
+# Takes effect from the next top-level statement
+enable_instrumentation()
+
+@testset "Instrumentation" begin
+    @testset "Instrumentation: sorts" begin
+        reset_instrumentation!()
+        BubbleSort!([3, 2, 1])
+        @test instrumentation_counts().comparisons == 6
+        @test instrumentation_counts().swaps == 3
+
+        reset_instrumentation!()
+        SelectionSort!([3, 2, 1])
+        @test instrumentation_counts().comparisons == 3
+        @test instrumentation_counts().swaps == 2
+
+        n = 1000
+        x = rand(MersenneTwister(28), n)
+        for sort_alg in (QuickSort!, MergeSort!, ParallelSort!)
+            reset_instrumentation!()
+            @test issorted(sort_alg(copy(x)))
+            @test n * log2(n) / 2 < instrumentation_counts().comparisons < 2 * n * log2(n)
+        end
+        reset_instrumentation!()
+        InsertionSort!(copy(x))
+        @test n^2 / 8 < instrumentation_counts().comparisons < n^2 / 2
+
+        reset_instrumentation!()
+        ParallelSort!(rand(10^5); ntasks = 2)
+        sections = instrumentation_sections()
+        @test sections["ParallelSort!/runs"].calls == 1
+        @test sections["ParallelSort!/merges"].calls == 1
+        @test sections["ParallelSort!/runs"].time > 0
+    end
+
+    @testset "Instrumentation: searches" begin
+        sample = [0, 23, 52, 552, 555, 602, 1004]
+        reset_instrumentation!()
+        @test binary_search(sample, 52) == 3:3
+        @test instrumentation_counts().probes == 6
+
+        reset_instrumentation!()
+        @test jump_search([1, 2, 3, 4, 13, 15, 20], 15) == 6
+        @test instrumentation_counts().probes == 5
+
+        # many more probes on skewed keys than on uniform ones
+        for keys in (collect(1:3:3000), [2.0^i for i in 1:60])
+            reset_instrumentation!()
+            index, probes = TheAlgorithms.interpolation_search_probes(keys, 1, length(keys), keys[end - 1])
+            @test index == length(keys) - 1
+            @test instrumentation_counts().probes == probes
+        end
+    end
+
+    @testset "Instrumentation: disjoint set and knapsack" begin
+        set = DisjointSet(5)
+        set.par .= [2, 3, 4, 5, 5]
+        reset_instrumentation!()
+        @test find(set, 1) == 5
+        @test instrumentation_counts().find_steps == 2
+        find(set, 1)
+        @test instrumentation_counts().find_steps == 3
+
+        reset_instrumentation!()
+        @test zero_one_pack!(20, [1, 3, 11], [2, 5, 30], zeros(Int, 30)) == 37
+        @test instrumentation_counts().dp_updates == 20 + 18 + 10
+    end
+
+    @testset "Instrumentation: report" begin
+        reset_instrumentation!()
+        QuickSort!(rand(100))
+        ParallelSort!(rand(10^5); ntasks = 2)
+        table = sprint(report)
+        @test occursin("comparisons", table) && occursin("ParallelSort!/merges", table)
+        json = sprint(io -> report(io; format = :json))
+        @test startswith(json, "{\"counters\": {\"comparisons\": $(instrumentation_counts().comparisons), \"swaps\": ")
+        @test occursin("\"ParallelSort!/runs\": {\"calls\": 1, \"time_ns\": ", json)
+        @test_throws ArgumentError report(IOBuffer(); format = :xml)
+        reset_instrumentation!()
+        @test all(iszero, instrumentation_counts())
+    end
+end
+
+enable_instrumentation(false)
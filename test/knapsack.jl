@@ -14,4 +14,46 @@
         @test complete_pack!(10, [1,3,11], [20,5,80], dp) == 200
     end
 
+    @testset "Knapsack: KnapsackSolver" begin
+        solver = KnapsackSolver()
+        @test knapsack!(solver, 20, [1,3,11], [2,5,30]) == (37, [1,1,1])
+        @test knapsack!(solver, 10, [1,3,11], [20,5,80]) == (25, [1,1,0])
+        unlimited = fill(typemax(Int), 3)
+        @test knapsack!(solver, 20, [1,2,9], [1,3,20], unlimited) == (43, [0,1,2])
+        @test knapsack!(solver, 10, [1,3,11], [20,5,80], unlimited) == (200, [10,0,0])
+        @test knapsack!(solver, 20, [1,2,9], [1,3,20], [5,5,2]) == (43, [0,1,2])
+        @test knapsack!(solver, 10, [3,4], [5,6], [2,1]) == (16, [2,1])
+        @test knapsack!(solver, 0, [1,2], [3,4]) == (0, [0,0])
+        @test knapsack!(KnapsackSolver{Float64}(), 5, [2,3], [1.5,2.5]) == (4.0, [1,1])
+        @test_throws ArgumentError knapsack!(solver, 10, [0,1], [1,1])
+        @test_throws DimensionMismatch knapsack!(solver, 10, [1,2], [1])
+
+        # capacities above 2^17 are shared out between tasks
+        rng = MersenneTwister(16)
+        for capacity in (1000, 2^17 + 5)
+            weights = rand(rng, 1:capacity ÷ 4, 20)
+            values = rand(rng, 1:1000, 20)
+            value, taken = knapsack!(solver, capacity, weights, values; ntasks = 4)
+            @test value == zero_one_pack!(capacity, weights, values, zeros(Int, capacity))
+            @test all(t -> t in (0, 1), taken)
+            @test sum(weights .* taken) <= capacity
+            @test sum(values .* taken) == value
+        end
+    end
+
+    @testset "Knapsack: subset_sums" begin
+        @test findall(subset_sums(10, [3,5])) .- 1 == [0,3,5,8]
+        @test subset_sums(0, [1]) == [true]
+        weights = [70, 64, 1, 3, 128, 200]
+        naive = falses(301)
+        naive[1] = true
+        for w in weights, s in 300:-1:w
+            naive[s + 1] |= naive[s - w + 1]
+        end
+        @test subset_sums(300, weights) == naive
+        reachable = falses(301)
+        @test subset_sums!(reachable, weights) === reachable
+        @test reachable == naive
+    end
+
 end
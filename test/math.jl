@@ -18,9 +18,57 @@
 
     @testset "Math: Area Under Curve" begin
         # Area by Trapazoid rule
-        @test trapazoidal_area(x -> 5, 12, 14, 1000) == 10.00000000000334
-        @test trapazoidal_area(x -> 9 * x^2, -4, 0, 1000) == 192.0000960000001
-        @test trapazoidal_area(x -> 9 * x^2, -4, 4, 1000) == 384.0007680000011
+        @test trapazoidal_area(x -> 5, 12, 14, 1000) ≈ 10
+        @test trapazoidal_area(x -> 9 * x^2, -4, 0, 1000) ≈ 192.000096
+        @test trapazoidal_area(x -> 9 * x^2, -4, 4, 1000) ≈ 384.000768
+        # signed areas
+        @test trapazoidal_area(x -> x, -2, 1, 1000) ≈ -1.5
+        @test abs(trapazoidal_area(sin, 0, 2π, 1000)) < 1.0e-12
+    end
+
+    @testset "Math: Quadrature" begin
+        x = range(0, π, length = 101)
+        y = sin.(x)
+        # the error of the trapezoidal rule is h^2 / 12 * (f'(b) - f'(a)) + O(h^4)
+        @test trapezoid(y, step(x)) ≈ 2 - step(x)^2 / 6 rtol = 1.0e-7
+        @test trapezoid(y, collect(x)) ≈ trapezoid(y, step(x))
+        @test trapezoid([1.0, 3.0], [0.0, 2.0]) == 4
+        @test simpson(y, step(x)) ≈ 2 rtol = 1.0e-7
+        # Simpson's rule is exact for cubics, with an even number of samples too
+        for n in (3, 4, 5, 10, 11)
+            t = range(-1, 2, length = n)
+            @test simpson(t .^ 3 .- t, step(t)) ≈ 15 / 4 - 3 / 2
+        end
+        Y = [sin(k * t) for t in x, k in 1:200]
+        out = zeros(200)
+        simpson!(out, Y, step(x); ntasks = 4)
+        @test out ≈ [simpson(Y[:, k], step(x)) for k in 1:200]
+        trapezoid!(out, Y, step(x); ntasks = 4)
+        @test out[2] ≈ 0 atol = 1.0e-12
+        @test_throws DimensionMismatch simpson!(zeros(3), Y, step(x))
+
+        integral, error = gauss_kronrod(x -> exp(-x^2), -10, 10)
+        @test integral ≈ sqrt(π)
+        @test error < 1.0e-8
+        @test gauss_kronrod(x -> 1 / sqrt(x), 0, 1; rtol = 1.0e-10)[1] ≈ 2 rtol = 1.0e-9
+        @test gauss_kronrod(x -> x^3, 1, 0)[1] ≈ -1 / 4
+        @test gauss_kronrod(x -> 3, 0, 2)[1] ≈ 6
+
+        integral, error = romberg(sin, 0, π)
+        @test integral ≈ 2
+        @test romberg(exp, 0, 1; rtol = 1.0e-12)[1] ≈ exp(1) - 1 rtol = 1.0e-12
+        @test_throws ArgumentError romberg(sin, 0, 1; maxlevels = 1)
+
+        a = collect(range(0, 1, length = 1000))
+        b = a .+ 1
+        out = zeros(1000)
+        gauss_kronrod!(out, exp, a, b; ntasks = 4)
+        @test out ≈ exp.(b) .- exp.(a)
+        fs = [x -> x^k for k in 0:9]
+        out = zeros(10)
+        gauss_kronrod!(out, fs, zeros(10), ones(10); ntasks = 4)
+        @test out ≈ [1 / (k + 1) for k in 0:9]
+        @test_throws DimensionMismatch gauss_kronrod!(zeros(2), exp, [0.0], [1.0])
     end
 
     @testset "Math: Area" begin
@@ -75,6 +123,50 @@
         @test_throws DomainError area_rhombus(-1, 2)
     end
 
+    @testset "Math: Batched Area" begin
+        rng = MersenneTwister(25)
+        n = 1000
+        a, b = rand(rng, n) .+ 1, rand(rng, n) .+ 1
+        c = a .+ b .- 0.5
+        out = zeros(n)
+        for (f!, f, args) in (
+            (surfarea_cube!, surfarea_cube, (a,)),
+            (surfarea_sphere!, surfarea_sphere, (a,)),
+            (area_square!, area_square, (a,)),
+            (area_circle!, area_circle, (a,)),
+            (area_rectangle!, area_rectangle, (a, b)),
+            (area_triangle!, area_triangle, (a, b)),
+            (area_parallelogram!, area_parallelogram, (a, b)),
+            (area_ellipse!, area_ellipse, (a, b)),
+            (area_rhombus!, area_rhombus, (a, b)),
+            (area_trapezium!, area_trapezium, (a, b, c)),
+            (area_heron_triangle!, area_heron_triangle, (a, b, c)),
+        )
+            @test f!(out, args...) === out
+            @test out == f.(args...)
+            @test f!(out, args...; ntasks = 4) == f.(args...)
+            bad = map(copy, args)
+            bad[end][n ÷ 2] = -1
+            @test_throws DomainError f!(out, bad...)
+        end
+        @test area_heron_triangle!(zeros(2), [3, 5], [4, 12], [5, 13]) == [6.0, 30.0]
+        @test_throws DomainError area_heron_triangle!(zeros(1), [1.0], [2.0], [4.0])
+        @test area_circle!(zeros(Float32, 2), Float32[1, 2]) ≈ Float32[π, 4π]
+        @test_throws DimensionMismatch area_rectangle!(zeros(3), ones(3), ones(2))
+
+        @test area_polygon([0, 4, 4, 0], [0, 0, 3, 3]) == 12.0
+        @test area_polygon([0, 0, 4, 4], [0, 3, 3, 0]) == 12.0
+        @test area_polygon([1e8, 1e8 + 1, 1e8 + 1, 1e8], [1e8, 1e8, 1e8 + 1, 1e8 + 1]) == 1.0
+        @test area_polygon([0.0, 1.0], [0.0, 1.0]) == 0.0
+        # regular polygons approach the unit circle
+        θ = range(0, 2π, length = 1001)[1:end-1]
+        @test area_polygon(cos.(θ), sin.(θ)) ≈ 1000 / 2 * sin(2π / 1000)
+        x, y = [0.0, 1, 0, 0, 2, 2, 0], [0.0, 0, 1, 0, 0, 2, 2]
+        @test area_polygon!(zeros(3), x, y, [1, 4, 8, 8]) == [0.5, 4.0, 0.0]
+        @test_throws ArgumentError area_polygon!(zeros(2), x, y, [1, 9, 8])
+        @test_throws DimensionMismatch area_polygon!(zeros(2), x, y, [1, 8])
+    end
+
     @testset "Math: Armstrong Number" begin
         x = 370     # an armstrong number
         @test is_armstrong(x) == true
@@ -88,6 +180,10 @@
         @test is_armstrong(x) == true
         x = 12      # Not an armstrong number
         @test is_armstrong(x) == false
+        @test is_armstrong(4498128791164624869) == true     # 19 digits, 9^19 alone is 1.35 * 10^18
+        @test is_armstrong(4498128791164624868) == false
+        @test is_armstrong(typemax(Int64)) == false
+        @test (0:9999)[is_armstrong.(0:9999)] == [0:9; 153; 370; 371; 407; 1634; 8208; 9474]
         end
 
     @testset "Math: Average Mean" begin
@@ -102,12 +198,33 @@
         @test mode([3, 4, 5, 3, 4, 2, 5, 2, 2, 4, 4, 4, 2, 2, 4, 2]) == [4, 2]
         @test mode(["x", "y", "y", "z"]) == ["y"]
         @test mode(["x", "x" , "y", "y", "z"]) == ["x", "y"]
+        @test mode(1:3) == [1, 2, 3]
+        @test mode([0.5, 1.5, 0.5]) isa Vector{Float64}
     end
 
     @testset "Math: Average Median" begin
         @test median([2,1,3,4]) == 2.5
         @test median([2, 70, 6, 50, 20, 8, 4]) == 8
         @test median([0]) == 0
+        @test median(1:10) == 5.5
+
+        rng = MersenneTwister(23)
+        for n in (1, 2, 3, 10, 101, 1000), data in (rand(rng, n), rand(rng, 1:5, n), collect(n:-1:1))
+            sorted = sort(data)
+            @test median!(copy(data)) == (sorted[(n + 1) ÷ 2] + sorted[n ÷ 2 + 1]) / 2
+            for p in (0, 0.1, 0.25, 0.9, 1)
+                h = (n - 1) * p + 1
+                k = floor(Int, h)
+                expected = k == n ? sorted[n] : sorted[k] + (h - k) * (sorted[k + 1] - sorted[k])
+                @test quantile!(copy(data), p) ≈ expected
+            end
+        end
+        v = [2, 70, 6, 50, 20, 8, 4]
+        @test quantile(v, 0.25) == 5
+        @test v == [2, 70, 6, 50, 20, 8, 4]
+        @test isnan(median([1.0, NaN, 2.0]))
+        @test_throws ArgumentError median!(Int[])
+        @test_throws ArgumentError quantile!([1, 2], 2)
     end
 
     @testset "Math: ceil_floor" begin
@@ -124,6 +241,22 @@
         @test collatz_sequence(3) == [3,10,5,16,8,4,2,1]
         @test collatz_sequence(42) == [42,21,64,32,16,8,4,2,1]
         @test collatz_sequence(5) == [5,16,8,4,2,1]
+        @test collatz_sequence(1) == [1]
+        @test collect(CollatzSequence(3)) == [3,10,5,16,8,4,2,1]
+        @test maximum(CollatzSequence(27)) == 9232
+        @test eltype(collatz_sequence(UInt8(7))) == UInt8
+        @test_throws DomainError CollatzSequence(0)
+        @test_throws OverflowError collatz_sequence(typemax(Int64))
+        @test length(collatz_sequence(big(2)^100 + 1)) > 100
+        @test collatz_stopping_times(1:10) == [0, 1, 7, 2, 5, 8, 16, 3, 19, 6]
+        @test collatz_stopping_times([27, 97]) == [111, 118]
+        times = collatz_stopping_times(1:10^4; memo_limit = 100, ntasks = 4)
+        @test times == [length(collatz_sequence(n)) - 1 for n in 1:10^4]
+        @test times == collatz_stopping_times(1:10^4)
+        out = zeros(Int32, 3)
+        @test collatz_stopping_times!(out, UInt64(10^9):UInt64(10^9 + 2)) === out
+        @test out == [length(collatz_sequence(n)) - 1 for n in 10^9:10^9+2]
+        @test_throws DomainError collatz_stopping_times(0:5)
     end
 
     @testset "Math: Line Length" begin
@@ -131,10 +264,55 @@
         @test line_length(x -> x, 0, 1, 10) == 1.4142135623730947
         @test line_length(x -> 1, -5.5, 4.5) == 9.999999999999977
         @test line_length(x -> sin(5 * x) + cos(10 * x) + 0.1 * x^2, 0, 10, 10000) == 69.53493003183544
+        x = range(0, 10, length = 10001)
+        @test line_length(x, sin.(5 .* x) .+ cos.(10 .* x) .+ 0.1 .* x .^ 2) ≈ 69.53493003183544
+        @test line_length([0, 3, 3], [0, 4, 0]) == 9.0
     end
 
     @testset "Math: Euler Method" begin
-        @test euler_method((x, t) -> x, 1, (0, 5))[1][end] == 143.33937864611195
+        x, t = euler_method((x, t) -> x, 1, (0, 5))
+        @test x[end] ≈ 1.01^500
+        @test t[end] == 5
+        @test euler_method((x, t) -> 1, 0, (1, 2), 0.25) == ([0, 0.25, 0.5, 0.75, 1], [1, 1.25, 1.5, 1.75, 2])
+        x, t = euler_method((x, t) -> -x, [1.0, 2.0], (1, 2), 1.0e-3)
+        @test x[end] ≈ [exp(-1), 2exp(-1)] rtol = 1.0e-3
+    end
+
+    @testset "Math: ODE Solvers" begin
+        decay!(du, u, p, t) = (du .= -p .* u)
+        exact(t) = [exp(-t), 2exp(-2t)]
+        ts = 0:0.1:1
+        for (method, tol) in ((ForwardEuler(1.0e-4), 1.0e-3), (RungeKutta4(1.0e-2), 1.0e-8),
+                (DormandPrince(abstol = 1.0e-10, reltol = 1.0e-10), 1.0e-7))
+            us = zeros(2, length(ts))
+            u = solve_ode!(us, ts, method, decay!, [1.0, 2.0], (0.0, 1.0), [1.0, 2.0])
+            @test u ≈ exact(1) rtol = tol
+            @test all(j -> isapprox(us[:, j], exact(ts[j]); rtol = tol), eachindex(ts))
+
+            # the same with SVector states
+            vs = Vector{SVector{2,Float64}}(undef, length(ts))
+            v = solve_ode!(vs, ts, method, (u, p, t) -> -p .* u, SVector(1.0, 2.0), (0.0, 1.0), SVector(1.0, 2.0))
+            @test v ≈ u
+            @test all(j -> vs[j] ≈ us[:, j], eachindex(ts))
+        end
+
+        times = Float64[]
+        u = solve_ode!((t, u) -> push!(times, t), RungeKutta4(0.1), (u, p, t) -> -u, 1.0, (0.0, 1.0); every = 2)
+        @test u ≈ exp(-1) rtol = 1.0e-5
+        @test times ≈ 0:0.2:1
+
+        # the adaptive steps get longer as the solution flattens
+        steps = Float64[]
+        solve_ode!((t, u) -> push!(steps, t), DormandPrince(), (u, p, t) -> -u, 1.0, (0.0, 20.0))
+        @test length(steps) < 30
+        @test maximum(diff(steps)) > 3 * diff(steps)[2]
+        @test steps[end] == 20
+
+        @test_throws DimensionMismatch solve_ode!(zeros(2, 3), ts, ForwardEuler(0.1), decay!, [1.0, 2.0], (0.0, 1.0), [1.0, 2.0])
+        @test_throws ArgumentError solve_ode!(zeros(2, 2), [0.5, 0.2], ForwardEuler(0.1), decay!, [1.0, 2.0], (0.0, 1.0), [1.0, 2.0])
+        @test_throws ArgumentError solve_ode!(zeros(2, 1), [2.0], ForwardEuler(0.1), decay!, [1.0, 2.0], (0.0, 1.0), [1.0, 2.0])
+        @test_throws DimensionMismatch solve_ode!((t, u) -> nothing, ForwardEuler(0.1), decay!, [1.0, 2.0], (0.0, 1.0), [1.0, 2.0];
+            cache = ode_cache(zeros(3)))
     end
 
     @testset "Math: Factorial Related" begin
@@ -145,6 +323,19 @@
         @test factorial_recursive(5) == 120
         @test_throws ErrorException  factorial_recursive(0.1)
         @test_throws ErrorException  factorial_recursive(-1)
+
+        @test factorial_fast(0) == 1
+        @test factorial_fast(5) == 120
+        @test factorial_fast(5.0) == 120
+        @test factorial_fast(34) isa BigInt
+        @test all(n -> factorial_fast(n) == factorial(big(n)), 0:200)
+        @test factorial_fast(5000; ntasks = 4) == factorial_iterative(5000)
+        @test factorial_fast(Int64, 20) === factorial(20)
+        @test factorial_fast(UInt128, 34) == factorial(big(34))
+        @test_throws OverflowError factorial_fast(Int64, 21)
+        @test_throws OverflowError factorial_fast(Int128, 34)
+        @test_throws DomainError factorial_fast(0.1)
+        @test_throws DomainError factorial_fast(-1)
     end
 
     @testset "Math: Prime Check" begin
@@ -163,6 +354,29 @@
         @test prime_check(1231) == true
         @test prime_check(2332) == false
         @test prime_check(2932) == false
+        @test prime_check(-7) == false
+        @test prime_check(7.0) == true
+        @test prime_check(65537) == true
+        @test prime_check(65539 * 65543) == false
+        @test prime_check(2^61 - 1) == true
+        @test prime_check(typemax(UInt64) - 58) == true # the largest 64-bit prime
+        @test prime_check(3215031751) == false # strong pseudoprime to the bases 2, 3, 5 and 7
+        @test prime_check(big(2)^89 - 1) == true
+        @test prime_check(UInt8(251)) == true
+        table = PrimeTable(10^5)
+        @test [prime_check(n) for n in 1:10^5] == [prime_check(table, n) for n in 1:10^5]
+    end
+
+    @testset "Math: Prime Table" begin
+        @test PrimeTable(100).primes == [2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97]
+        @test length(PrimeTable(10^6)) == 78498
+        @test PrimeTable(10^6; ntasks = 4).primes == PrimeTable(10^6; ntasks = 1).primes
+        @test PrimeTable(1).primes == []
+        @test PrimeTable(2).primes == [2]
+        @test PrimeTable(3).primes == [2, 3]
+        table = PrimeTable(3 * 2^15 + 7; ntasks = 3) # segments plus a partial one
+        @test table.primes == filter(prime_check, 1:3 * 2^15 + 7)
+        @test_throws ArgumentError PrimeTable(2^33)
     end
 
     @testset "Math: Prime Factors" begin
@@ -174,11 +388,34 @@
         @test prime_factors(0.02) == []
         @test prime_factors(10^-354) == []
         @test_throws MethodError prime_factors("hello")
+
+        @test prime_factors(35) == [5, 7]
+        @test prime_factors(Int32(97)) isa Vector{Int32}
+        @test prime_factors(UInt64(2)^63) == fill(UInt64(2), 63)
+        @test prime_factors(1000000007 * 998244353) == [998244353, 1000000007]
+        @test prime_factors(UInt64(4294967291)^2) == [4294967291, 4294967291]
+        @test prime_factors(typemax(Int64)) == [7, 7, 73, 127, 337, 92737, 649657]
+        @test prime_factors(big(2)^64 + 1) == [274177, 67280421310721]
+        @test prime_factors(50.0) == [2, 5, 5]
+        @test prime_factors(PrimeTable(1000), 2 * 1009 * 1013) == [2, 1009, 1013]
+        for n in rand(2:typemax(Int64), 100)
+            factors = prime_factors(n)
+            @test prod(factors) == n
+            @test issorted(factors) && all(prime_check, factors)
+        end
     end
 
     @testset "Math: Perfect Cube" begin
         @test perfect_cube(27) == true
         @test perfect_cube(4) == false
+        @test perfect_cube(-8) == true
+        @test perfect_cube(0) == true
+        @test perfect_cube(typemin(Int64)) == true # (-2^21)^3
+        @test perfect_cube(2^62) == false
+        @test perfect_cube(UInt64(2)^63) == true
+        @test perfect_cube(typemax(UInt64)) == false
+        @test perfect_cube(big(10)^60 + 1) == false
+        @test findall(perfect_cube.(1:1000)) == [1, 8, 27, 64, 125, 216, 343, 512, 729, 1000]
     end
 
     @testset "Math: Perfect Number" begin
@@ -187,6 +424,15 @@
         @test perfect_number(496) == true
         @test perfect_number(8128)== true
         @test perfect_number(123) == false
+        @test perfect_number(1) == false
+        @test perfect_number(33550336) == true
+        @test perfect_number(2^30 * (2^31 - 1)) == true
+        @test perfect_number(2^30 * (2^31 - 1) + 2) == false
+        @test findall(perfect_numbers(1:10^4)) == [6, 28, 496, 8128]
+        @test findall(perfect_numbers(1:10^5; ntasks = 3)) == [6, 28, 496, 8128]
+        @test (-5:30)[perfect_numbers(-5:30)] == [6, 28]
+        @test perfect_numbers(20:10000) == map(perfect_number, 20:10000)
+        @test perfect_numbers(1:10^4) == perfect_number.(1:10^4)
     end
 
     @testset "Math: Perfect Square" begin
@@ -195,22 +441,37 @@
         @test perfect_square(1) == true
         @test perfect_square(0) == true
         @test perfect_square(10)== false
+        @test perfect_square(-4) == false
+        @test perfect_square((2^31 - 1)^2) == true
+        @test perfect_square((2^31 - 1)^2 + 1) == false
+        @test perfect_square(big(10)^40) == true
+        @test findall(perfect_square.(1:50)) == [1, 4, 9, 16, 25, 36, 49]
+        @test map_predicate(perfect_square, 1:10^5; ntasks = 4) == map(perfect_square, 1:10^5)
     end
 
     @testset "Math: SIR Model" begin
-        # TODO: implement tests
-
-        #initian conditions
-        p = [0.5/7900000.0,0.33]
-        u0 = [7900000.0,10.0,0.0]
-        tspan = (0.0,140.0)
-
-        #solve
-        sir = ODEProblem(SIR,u0,tspan,p)
-        sol = solve(sir)
-
-        #plot
-        plot(sol)
+        p = [0.5 / 7900000.0, 0.33]
+        u0 = [7900000.0, 10.0, 0.0]
+        ts = 0:1.0:140
+        us = solve_sir(u0, (0.0, 140.0), p; ts = ts)
+        @test length(us) == length(ts)
+        # the population is constant, and s = s0 exp(-b r / k)
+        @test all(u -> sum(u) ≈ sum(u0), us)
+        @test all(u -> isapprox(u[1], u0[1] * exp(-p[1] * u[3] / p[2]); rtol = 1.0e-5), us)
+        # the in-place right-hand side, with fixed steps
+        vs = zeros(3, length(ts))
+        solve_ode!(vs, ts, RungeKutta4(0.01), SIR, u0, (0.0, 140.0), p)
+        @test all(j -> isapprox(vs[:, j], us[j]; rtol = 1.0e-5), eachindex(ts))
+
+        ps = [SVector(b / 7900000.0, 0.33) for b in range(0.3, 0.6, length = 100)]
+        finals = Vector{SVector{3,Float64}}(undef, 100)
+        solve_ensemble!(finals, DormandPrince(reltol = 1.0e-6), SIR, SVector{3}(u0), (0.0, 140.0), ps; ntasks = 4)
+        @test finals[end] ≈ solve_sir(u0, (0.0, 140.0), ps[end]; ts = [140.0])[1]
+        # faster infections, more recovered
+        @test issorted([u[3] for u in finals])
+        matrix = zeros(3, 100)
+        solve_ensemble!(matrix, DormandPrince(reltol = 1.0e-6), SIR, fill(u0, 100), (0.0, 140.0), collect.(ps); ntasks = 4)
+        @test all(i -> matrix[:, i] ≈ finals[i], 1:100)
     end
 
     @testset "Math: Sum of Arithmetic progression" begin
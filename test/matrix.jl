@@ -8,6 +8,27 @@
         @test determinant(M1) == det(M1)
         @test round(determinant(M2),digits = 4) == round(det(M2),digits = 4)
         @test round(determinant(M3),digits = 4) == round(det(M3),digits = 4)
+
+        # needs pivoting: the first pivot is zero
+        @test determinant([0 1; 1 0]) == -1
+        @test determinant([1 2; 2 4]) == 0
+        @test determinant(zeros(0, 0)) == 1
+        @test_throws DomainError determinant(rand(2, 3))
+
+        # several blocks of columns, reusing the workspace
+        F = LUWorkspace{Float64}(150)
+        for _ in 1:3
+            A = rand(150, 150)
+            @test determinant!(F, A) ≈ det(A)
+        end
+        @test_throws DimensionMismatch determinant!(F, rand(3, 3))
+
+        A = rand(Float32, 100, 100)
+        @test determinant(A) isa Float32
+        @test determinant(A) ≈ det(A) rtol = 1e-3
+        A = rand(BigFloat, 70, 70)
+        @test determinant(A) isa BigFloat
+        @test determinant(A) ≈ det(A)
     end
 
     @testset "Matrix: LU Decompose" begin
@@ -29,6 +50,19 @@
         ]
 
 	    @test lu_decompose(mat) == (L,U)
+
+        for n in (1, 5, 64, 65, 200)
+            A = rand(n, n)
+            F = lu_decompose!(LUWorkspace(A), A)
+            p = collect(1:n)
+            for i in 1:n
+                p[i], p[F.pivots[i]] = p[F.pivots[i]], p[i]
+            end
+            L = UnitLowerTriangular(F.factors)
+            U = UpperTriangular(F.factors)
+            @test L * U ≈ A[p, :]
+            @test all(abs.(tril(F.factors, -1)) .<= 1)
+        end
     end
 	
 	@testset "Matrix: rotation matrix" begin
@@ -37,5 +71,42 @@
 		b = [0;1]
 		@test rotation_matrix(theta)*a == [cos(theta);sin(theta)]
 		@test rotation_matrix(theta)*b == [-sin(theta);cos(theta)]
+		@test rotation_matrix(theta) isa SMatrix{2,2,Float64}
+
+		# 3D: axis-angle and the matching quaternion
+		R = rotation_matrix([0, 0, 2], pi/2)
+		@test R isa SMatrix{3,3,Float64}
+		@test R * SVector(1, 0, 0) ≈ SVector(0, 1, 0) atol = 1e-12
+		@test R * SVector(0, 0, 1) ≈ SVector(0, 0, 1)
+		axis = normalize([1.0, 2.0, 3.0])
+		R = rotation_matrix(axis, 0.7)
+		@test R' * R ≈ I
+		@test det(R) ≈ 1
+		@test rotation_matrix(cos(0.35), (sin(0.35) .* axis)...) ≈ R
+		@test rotation_matrix(2cos(0.35), (2sin(0.35) .* axis)...) ≈ R
+		@test_throws DimensionMismatch rotation_matrix([1, 0], 0.1)
+
+		points = [SVector(rand(), rand()) for _ in 1:1000]
+		out = similar(points)
+		@test rotate_points!(out, theta, points) ≈ [rotation_matrix(theta) * p for p in points]
+		rotate_points!(points, rotation_matrix(theta))
+		@test points == out
+		@test_throws DimensionMismatch rotate_points!(out[1:2], theta, points)
+	end
+
+	@testset "Matrix: static determinant and LU" begin
+		for N in 1:6
+			A = SMatrix{N,N}(rand(N, N)) + N * I
+			@test determinant(A) ≈ det(Matrix(A))
+			L, U = lu_decompose(A)
+			@test L isa SMatrix{N,N,Float64}
+			@test L ≈ lu_decompose(Matrix(A))[1]
+			@test U ≈ lu_decompose(Matrix(A))[2]
+			@test L * U ≈ A
+		end
+		@test determinant(@SMatrix [1 0; 2 2]) === 2.0
+		@test determinant(@SMatrix [0 1 0 0; 1 0 0 0; 0 0 1 0; 0 0 0 1]) == -1
+		@test determinant(@SMatrix [1 2 3 4; 2 4 6 8; 0 0 1 0; 0 0 0 1]) == 0
+		@test lu_decompose(SMatrix{3,3}(float.([2 -1 -2; -4 6 3; -4 -2 8]))) == ([1 0 0; -2 1 0; -2 -1 1], [2 -1 -2; 0 4 -1; 0 0 3])
 	end
 end
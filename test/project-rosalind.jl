@@ -12,4 +12,98 @@
         @test reverse_complement("AAAACCCGGT") == "ACCGGGTTTT"
     end
 
+    @testset "Project Rosalind: PackedDNA" begin
+        s = "AGCTTTTCATTCTGACTGCAACGGGCAATATGTCTCTGTGTGGATTAAAAAAAGAGTGTCTGATAGCAGC"
+        dna = PackedDNA(s)
+        @test length(dna) == length(s)
+        @test String(dna) == s
+        @test collect(dna) == collect(s)
+        @test dna[5] == 'T'
+        @test_throws BoundsError dna[length(s) + 1]
+        @test count_nucleotides(dna) == count_nucleotides(s) == "20 21 17 12"
+        @test nucleotide_counts(dna) == (A = 20, C = 12, G = 17, T = 21)
+        @test String(PackedDNA(lowercase(s))) == s
+        @test String(PackedDNA(Vector{UInt8}(s))) == s
+        @test_throws ArgumentError PackedDNA("ACGN")
+
+        rna = dna2rna(PackedDNA("GATGGAACTTGACTACGTAAATT"))
+        @test rna isa PackedRNA
+        @test String(rna) == "GAUGGAACUUGACUACGUAAAUU"
+        @test rna[4] == 'G' && rna[3] == 'U'
+
+        @test String(reverse_complement(PackedDNA("AAAACCCGGT"))) == "ACCGGGTTTT"
+        # every length around the word boundaries
+        for n in [0:3; 30:34; 63:66; 1000]
+            s = String(rand(['A', 'C', 'G', 'T'], n))
+            dna = PackedDNA(s)
+            @test String(dna) == s
+            @test String(reverse_complement(dna)) == reverse_complement(s)
+            @test count_nucleotides(dna) == count_nucleotides(s)
+        end
+
+        # wrapping packed words, the unused bits do not matter
+        dna = PackedDNA(s)
+        words = copy(dna.data)
+        words[end] |= ~zero(UInt64) << (2 * (length(s) % 32))
+        @test count_nucleotides(PackedDNA(words, length(s))) == count_nucleotides(s)
+        @test String(reverse_complement(PackedDNA(words, length(s)))) == reverse_complement(s)
+        bytes = Vector{UInt8}(undef, 8 * length(dna.data))
+        copyto!(bytes, reinterpret(UInt8, dna.data))
+        @test String(PackedDNA(bytes, length(s))) == s
+        @test_throws ArgumentError PackedDNA(bytes[1:end-1], length(s))
+        @test_throws ArgumentError PackedDNA(UInt64[1], 33)
+    end
+
+    @testset "Project Rosalind: FASTA/FASTQ reader" begin
+        fasta = ">seq1 first\nAGCTTTTCATTC\nTGACTGCAAC\n\n>seq2\r\nGGGCAATAtg\r\n>empty\n>seq3\nNNACGT"
+        reader = FastxReader(Vector{UInt8}(fasta))
+        @test reader.format == :fasta
+        records = collect(reader)
+        @test length(records) == 4
+        @test String(records[1].identifier) == "seq1 first"
+        @test sequence(records[1]) == "AGCTTTTCATTCTGACTGCAAC"
+        @test String(records[2].identifier) == "seq2"
+        @test sequence(records[2]) == "GGGCAATAtg"
+        @test isempty(records[3].sequence)
+        @test sequence(records[4]) == "NNACGT"
+        @test all(r -> isempty(r.quality), records)
+        @test nucleotide_counts(reader) == (A = 9, C = 8, G = 8, T = 11)
+        @test count_nucleotides(reader) == "9 11 8 8"
+        @test reverse_complement(reader) == ["GTTGCAGTCAGAATGAAAAGCT", "caTATTGCCC", "", "ACGTNN"]
+
+        fastq = "@r1\nACGT\n+\n@@@@\n@r2\nTTGA\n+r2\nIIII\n"
+        reader = FastxReader(Vector{UInt8}(fastq))
+        @test reader.format == :fastq
+        records = collect(reader)
+        @test [String(r.identifier) for r in records] == ["r1", "r2"]
+        @test [String(r.quality) for r in records] == ["@@@@", "IIII"]
+        @test count_nucleotides(reader) == "2 3 2 1"
+        @test reverse_complement(reader) == ["ACGT", "TCAA"]
+        @test_throws ArgumentError collect(FastxReader(Vector{UInt8}("@r1\nACGT\nIIII\n")))
+        @test_throws ArgumentError FastxReader(Vector{UInt8}("ACGT"))
+        @test isempty(collect(FastxReader(UInt8[])))
+
+        # a file big enough to be split in chunks, whose quality lines start with '@'
+        path, io = mktemp()
+        sequences = [String(rand(['A', 'C', 'G', 'T'], rand(50:150))) for _ in 1:30_000]
+        for (i, s) in enumerate(sequences)
+            print(io, "@read", i, "\n", s, "\n+\n", "@"^length(s), "\n")
+        end
+        close(io)
+        reader = FastxReader(path)
+        @test length(TheAlgorithms.fastx_chunks(reader, 4, true)) > 1
+        @test count_nucleotides(reader, ntasks = 4) == count_nucleotides(join(sequences))
+        @test reverse_complement(reader, ntasks = 4) == reverse_complement.(sequences)
+        @test count(_ -> true, reader) == length(sequences)
+
+        path, io = mktemp()
+        for (i, s) in enumerate(sequences)
+            print(io, ">read", i, "\n", s[1:end÷2], "\n", s[end÷2+1:end], "\n")
+        end
+        close(io)
+        reader = FastxReader(path)
+        @test count_nucleotides(reader, ntasks = 3) == count_nucleotides(join(sequences))
+        @test reverse_complement(reader, ntasks = 3) == reverse_complement.(sequences)
+    end
+
 end
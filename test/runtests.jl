@@ -1,12 +1,9 @@
 using TheAlgorithms
 using Test
 
-using DataFrames
-using DifferentialEquations
-using GLM
 using LinearAlgebra
-using Plots
 using Random
+using StaticArrays
 
 @testset "TheAlgorithms" begin
 
@@ -18,7 +15,11 @@ include("project-rosalind.jl")
 include("searches.jl")
 include("sorts.jl")
 include("statistics.jl")
+include("strings.jl")
 include("scheduling.jl")
 include("conversions.jl")
+include("distributed.jl")
+include("workspace.jl")
+include("instrumentation.jl")
 
 end
@@ -6,4 +6,65 @@
         burst_times = Any[10, 5, 8]
         @test fcfs(n, process_id, burst_times) == (Any[1, 2, 3], Any[10, 5, 8], Any[0, 10, 15], Any[10, 15, 23], 8.333333333333334, 16.0)
     end
+
+    @testset "Scheduling: Scheduler" begin
+        scheduler = Scheduler()
+
+        result = simulate!(scheduler, FCFS(), [0, 0, 0], [10, 5, 8])
+        @test result.waiting == [0, 10, 15]
+        @test result.turnaround == [10, 15, 23]
+        @test average_waiting_time(result) == fcfs(3, Any[1, 2, 3], Any[10, 5, 8])[5]
+        # unsorted arrivals, with the CPU idle in between
+        result = simulate!(scheduler, FCFS(), [3, 0], [1, 2])
+        @test result.start == [3, 0]
+        @test result.completion == [4, 2]
+        @test result.waiting == [0, 0]
+
+        result = simulate!(scheduler, SJF(), [0, 0, 0, 0], [6, 8, 7, 3])
+        @test result.waiting == [3, 16, 9, 0]
+        @test average_waiting_time(result) == 7
+
+        result = simulate!(scheduler, SRTF(), [0, 1, 2, 3], [8, 4, 9, 5])
+        @test result.completion == [17, 5, 26, 10]
+        @test result.response == [0, 0, 15, 2]
+        @test average_waiting_time(result) == 6.5
+        @test result.context_switches[] == 4
+
+        result = simulate!(scheduler, RoundRobin(4), [0, 0, 0], [24, 3, 3])
+        @test result.completion == [30, 7, 10]
+        @test result.waiting == [6, 4, 7]
+        @test result.context_switches[] == 3
+        @test_throws ArgumentError RoundRobin(0)
+
+        result = simulate!(scheduler, PriorityScheduling(), zeros(Int, 5), [10, 1, 2, 1, 5], [3, 1, 4, 5, 2])
+        @test result.waiting == [6, 0, 16, 18, 1]
+        @test average_turnaround_time(result) == 12
+        # without aging, the more urgent process arrived at 4 runs first
+        result = simulate!(scheduler, PriorityScheduling(), [0, 1, 4], [5, 2, 2], [1, 3, 1])
+        @test result.completion == [5, 9, 7]
+        # the process waiting since 1 overtakes the more urgent one arrived at 4
+        result = simulate!(scheduler, PriorityScheduling(aging = 1), [0, 1, 4], [5, 2, 2], [1, 3, 1])
+        @test result.completion == [5, 7, 9]
+        @test_throws ArgumentError simulate!(scheduler, PriorityScheduling(), [0, 1], [1, 1])
+
+        @test_throws DimensionMismatch simulate!(scheduler, SJF(), [0, 1], [1])
+        @test_throws ArgumentError simulate!(scheduler, SJF(), [0, 1], [1, 0])
+        @test isempty(simulate!(scheduler, SRTF(), Int[], Int[]).completion)
+
+        # every policy keeps the CPU busy while processes are ready, so they all finish together
+        rng = MersenneTwister(20)
+        arrival = rand(rng, 0:1000, 1000)
+        burst = rand(rng, 1:20, 1000)
+        priority = rand(rng, 1:10, 1000)
+        makespan = 0
+        for p in sortperm(arrival)
+            makespan = max(makespan, arrival[p]) + burst[p]
+        end
+        for policy in (FCFS(), SJF(), SRTF(), RoundRobin(3), PriorityScheduling(aging = 5))
+            result = simulate!(scheduler, policy, arrival, burst, priority)
+            @test maximum(result.completion) == makespan
+            @test allunique(result.completion)
+            @test all(0 .<= result.response .<= result.waiting)
+        end
+    end
 end
@@ -7,6 +7,31 @@
         binary_search(sample, 52)
         binary_search(reversed_sample, 52, rev=true)
         @test_throws ErrorException binary_search(unsorted_sample, 21)  # throws an error
+
+        @test binary_search(sample, 52) == 3:3
+        @test binary_search(reversed_sample, 52, rev=true) == 5:5
+        @test binary_search(sample, 53) == 4:3
+        @test binary_search(sample, -1) == 1:0
+        @test binary_search(sample, 2000, check_sorted=false) == 8:7
+        @test binary_search([1, 2, 2, 2, 3], 2) == 2:4
+        @test binary_search(["a", "bb", "ccc"], "xx", by=length) == 2:2
+    end
+
+    @testset "Searches: SortedIndex" begin
+        for n in (0, 1, 2, 7, 8, 100, 1001), rev in (false, true)
+            keys = sort(rand(1:n+1, n), rev=rev)
+            idx = SortedIndex(keys, rev=rev)
+            queries = collect(0:n+2)
+            @test [searchsortedfirst(idx, q) for q in queries] == [searchsortedfirst(keys, q, rev=rev) for q in queries]
+            @test [searchsortedlast(idx, q) for q in queries] == [searchsortedlast(keys, q, rev=rev) for q in queries]
+            @test [binary_search(idx, q) for q in queries] == [searchsorted(keys, q, rev=rev) for q in queries]
+            @test searchsorted_batch!(similar(queries), idx, queries) == [searchsortedfirst(keys, q, rev=rev) for q in queries]
+            @test all(q -> (q in idx) == (q in keys), queries)
+        end
+        idx = SortedIndex([0.5, 1.5, 2.5])
+        @test searchsorted(idx, 1.5) == 2:2
+        @test_throws ArgumentError SortedIndex([3, 1, 2])
+        @test_throws DimensionMismatch searchsorted_batch!(zeros(Int, 2), idx, [1.0])
     end
 
     @testset "Searches: Linear" begin
@@ -24,6 +49,14 @@
         r = n;
 
         exponential_search(arr, x)
+        @test exponential_search(arr, x) == 4
+        @test exponential_search(arr, 1) == 1
+        @test exponential_search(arr, 20) == 7
+        @test exponential_search(arr, 5) == -1
+        @test exponential_search(arr, 0) == -1
+        @test exponential_search(Int[], 0) == -1
+        @test binary_search(arr, l, r, 13) == 5
+        @test binary_search(arr, l, r, 14) == -1
     end
 
     @testset "Searches: Interpolation" begin
@@ -34,6 +67,13 @@
         r = n;
 
         interpolation_search(arr, l, r, x)
+        @test interpolation_search(arr, l, r, x) == 6
+        @test interpolation_search(arr, x) == 6
+        @test interpolation_search(arr, 14) == -1
+        @test interpolation_search(arr, 21) == -1
+        @test interpolation_search([5, 5, 5], 5) == 1
+        @test interpolation_search([0.5, 1.5, 2.5], 2.5) == 3
+        @inferred interpolation_search(arr, l, r, x)
     end
 
     @testset "Searches: Jump" begin
@@ -43,6 +83,39 @@
         n = size(arr)[1];
 
         jump_search(arr, x, jump)
+        @test jump_search(arr, x, jump) == 4
+        @test jump_search([1, 2, 3, 4, 13, 15, 20], 15) == 6
+        @test jump_search([1, 2, 3, 4, 13, 15, 20], 15, 100) == 6
+        @test jump_search([1, 2, 3, 4, 13, 15, 20], 16) == -1
+        @test jump_search(Int[], 1) == -1
+    end
+
+    @testset "Searches: Adaptive" begin
+        # near-uniform keys
+        keys = collect(1:3:3000)
+        idx = AdaptiveIndex(keys)
+        @test idx.strategy == :interpolation
+        @test adaptive_search(idx, 7) == 3
+        @test adaptive_search(idx, 8) == -1
+
+        # skewed keys
+        keys = [2.0^i for i in 1:1000]
+        idx = AdaptiveIndex(keys)
+        @test idx.strategy == :binary
+        @test adaptive_search(idx, 2.0^500) == 500
+        @test adaptive_search(idx, 3.0) == -1
+
+        # a few small keys in front of a uniform block skew interpolation,
+        # unless the queries only hit the front
+        keys = vcat(1.0:1000.0, range(1e12, 2e12, length=10^6))
+        @test AdaptiveIndex(keys).strategy == :binary
+        idx = AdaptiveIndex(keys, sample=keys[1:64])
+        @test idx.strategy == :exponential
+        @test adaptive_search(idx, 10.0) == 10
+        @test adaptive_search(idx, keys[end]) == length(keys)
+
+        @test adaptive_search(AdaptiveIndex(Int[]), 1) == -1
+        @test_throws ArgumentError AdaptiveIndex([3, 1, 2])
     end
 
 end
@@ -8,4 +8,70 @@
     x=[3,5,1,4,2]
     SelectionSort!(x)
     @test x == [1,2,3,4,5]
-end
\ No newline at end of file
+
+    @testset "Sorts: $(nameof(sort_alg))" for sort_alg in (QuickSort!, MergeSort!, RadixSort!)
+        x=[3,5,1,4,2]
+        sort_alg(x)
+        @test x == [1,2,3,4,5]
+        sort_alg(x, rev=true)
+        @test x == [5,4,3,2,1]
+
+        for T in (Int8, Int, UInt32, Float32, Float64), n in (0, 1, 17, 1000)
+            x=rand(T, n)
+            @test sort_alg(copy(x)) == sort(x)
+            @test sort_alg(copy(x), rev=true) == sort(x, rev=true)
+            y=sort_alg(copy(x), by=abs)
+            @test issorted(y, by=abs) && sort(y) == sort(x)
+        end
+
+        # views and other AbstractVectors
+        x=collect(10:-1:1)
+        sort_alg(view(x, 3:8))
+        @test x == [10,9,3,4,5,6,7,8,2,1]
+
+        # negative floats and signed zeros
+        x=[2.5,-0.0,-Inf,1e-300,-3.5,0.0,Inf,-1e-300]
+        @test sort_alg(copy(x)) == sort(x)
+    end
+
+    @testset "Sorts: stability" begin
+        x=[(i % 3, i) for i in 1:100]
+        @test MergeSort!(copy(x), by=first) == sort(x, by=first, alg=MergeSort)
+        @test RadixSort!(copy(x), by=first) == sort(x, by=first, alg=MergeSort)
+    end
+
+    @testset "Sorts: MergeSort! buffer" begin
+        buffer=Int[]
+        MergeSort!(rand(Int, 1001), buffer)
+        @test length(buffer) == 501
+        x=rand(Int, 1000)
+        @test MergeSort!(copy(x), buffer) == sort(x)
+        @test_throws ArgumentError MergeSort!(rand(1000), view(zeros(1000), 1:10))
+    end
+
+    @testset "Sorts: ParallelSort!" begin
+        for ntasks in (1, 2, 3, 8), T in (Int, Float64)
+            x=rand(T, 10^5 + 7)
+            @test ParallelSort!(copy(x), ntasks=ntasks) == sort(x)
+            @test ParallelSort!(copy(x), ntasks=ntasks, rev=true) == sort(x, rev=true)
+        end
+        # stable, and the shared buffer is reused
+        buffer=Tuple{Int,Int}[]
+        x=[(rand(1:10), i) for i in 1:10^5]
+        @test ParallelSort!(copy(x), buffer, ntasks=4, by=first) == sort(x, by=first, alg=MergeSort)
+        @test length(buffer) == 10^5
+        x=rand(2 * 10^5)
+        ParallelSort!(view(x, 1:10^5))
+        @test issorted(view(x, 1:10^5))
+        @test_throws ArgumentError ParallelSort!(rand(10^5), view(zeros(10), 1:10))
+    end
+
+    @testset "Sorts: QuickSort! custom lt" begin
+        x=["pear","fig","banana","kiwi"]
+        @test QuickSort!(copy(x), lt=(a, b) -> length(a) < length(b))[[1,4]] == ["fig","banana"]
+        # many equal keys and sorted inputs are the quicksort worst cases
+        for x in (rand(1:3, 10^4), collect(1:10^4), collect(10^4:-1:1))
+            @test QuickSort!(copy(x)) == sort(x)
+        end
+    end
+end
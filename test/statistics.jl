@@ -4,13 +4,63 @@
         a = [10, 14,17,21,20, 18, 42, 51, 77, 11, 91]
         b = [0.11,0.7,0.2,0.19,0.09,0.8, 0.71,0.1, 0.6,0.3,0.81]
         OLSbeta(a, b)
+        @test OLSbeta(a, b) ≈ (b' * a) / (b' * b)
 
-        df = DataFrame(a=a, b=b)
-        ols = GLM.lm(@formula(a ~ b), df)
-        coef(ols) # print coefficients
+        # with an intercept, as GLM.lm(@formula(a ~ b), DataFrame(a=a, b=b)) would fit it
+        X = [ones(length(b)) b]
+        @test OLSbeta(a, X) ≈ X \ a
 
-        # Predict
-        predict(ols) # predict the model
+        # streamed in batches, with one row at a time at the end
+        X = [ones(1000) randn(1000, 3)]
+        y = X * [1.0, 2.0, -3.0, 0.5] + 0.01 * randn(1000)
+        solver = OLSSolver(4)
+        for rows in Iterators.partition(1:990, 100)
+            fit!(solver, X[rows, :], y[rows])
+        end
+        for i in 991:1000
+            fit!(solver, X[i, :], y[i])
+        end
+        @test nobs(solver) == 1000
+        β = zeros(4)
+        @test coef!(β, solver) === β
+        @test β ≈ X \ y
+        @test coef(solver) == β
+        @test_throws DimensionMismatch fit!(solver, X[:, 1:3], y)
+        @test_throws DimensionMismatch fit!(solver, X, y[1:10])
+        @test_throws DimensionMismatch coef!(zeros(3), solver)
+        @test nobs(empty!(solver)) == 0
+        @test all(iszero, coef(fit!(solver, X, zeros(1000))))
+        @test_throws DimensionMismatch fit!(solver, X[1, 1:3], y[1])
+
+        # one row at a time allocates nothing
+        row_solver = OLSSolver(4)
+        row, response = X[1, :], y[1]
+        check = () -> (fit!(row_solver, row, response); fit!(row_solver, row, response, 0.5))
+        check()
+        @test @allocated(check()) == 0
+        @test nobs(row_solver) == 4
+        @test row_solver.xtx ≈ 3 * (row * row') && row_solver.xty ≈ 3 * response * row
+
+        # weights: the solution of sqrt(w) .* X \ (sqrt(w) .* y)
+        w = rand(1000)
+        solver = fit!(OLSSolver(4), X, y, w)
+        @test coef(solver) ≈ (sqrt.(w) .* X) \ (sqrt.(w) .* y)
+        @test coef(fit!(OLSSolver(4), X, y, ones(1000))) ≈ X \ y
+
+        # a duplicated regressor: its coefficient goes to one of the copies
+        x = collect(1.0:20.0)
+        X = [ones(20) x x]
+        y = 1 .+ 2 .* x
+        β = coef(fit!(OLSSolver(3), X, y))
+        @test X * β ≈ y
+        @test β[1] ≈ 1
+        @test count(iszero, β) == 1
+        @test sum(β[2:3]) ≈ 2
+
+        # other element types
+        solver = fit!(OLSSolver{BigFloat}(2), [ones(10) 1:10], 3 .+ 2 .* (1:10))
+        @test coef(solver) isa Vector{BigFloat}
+        @test coef(solver) ≈ [3, 2]
     end
 
     @testset "Statistics: Pearson Correlation" begin
@@ -26,7 +76,97 @@
 
     @testset "Statistics: Variance" begin
         a = 1:10
-        @test variance(a) == 5.5
+        @test variance(a) ≈ 55 / 6
+        @test variance([2, 4, 6]) == 4
+        @test variance(Float32[1, 2, 3, 4]) isa Float32
+        x = randn(10_000)
+        @test variance(x) ≈ sum((x .- sum(x) / length(x)).^2) / (length(x) - 1)
+    end
+
+    @testset "Statistics: Online statistics" begin
+        x = 1e9 .+ rand(100_000)
+        y = 2 .* x .+ 3 .+ 0.1 .* randn(100_000)
+        mx = sum(x) / length(x)
+        my = sum(y) / length(y)
+        ref_var = sum((x .- mx).^2) / (length(x) - 1)
+        ref_cov = sum((x .- mx) .* (y .- my)) / (length(x) - 1)
+
+        acc = Moments{Float64}()
+        for chunk in Iterators.partition(x, 1000)
+            fit!(acc, chunk)
+        end
+        @test nobs(acc) == length(x)
+        @test mean(acc) ≈ mx
+        @test variance(acc) ≈ ref_var rtol = 1e-6
+        @test variance(Moments(x)) ≈ ref_var rtol = 1e-6
+        @test variance(acc, corrected=false) ≈ ref_var * (length(x) - 1) / length(x) rtol = 1e-6
+
+        # one value at a time, merged partials and tasks agree with the chunked fit
+        one_by_one = Moments{Float64}()
+        foreach(v -> fit!(one_by_one, v), x)
+        @test variance(one_by_one) ≈ ref_var rtol = 1e-6
+        merged = merge(Moments(view(x, 1:30_000)), Moments(view(x, 30_001:100_000)))
+        @test variance(merged) ≈ ref_var rtol = 1e-6
+        @test variance(fit!(Moments{Float64}(), x, ntasks=4)) ≈ ref_var rtol = 1e-6
+        @test nobs(merge!(Moments{Float64}(), Moments{Float64}())) == 0
+        @test variance(fit!(Moments{Float64}(), (v for v in 1:10))) ≈ 55 / 6
+
+        acc = CoMoments{Float64}()
+        for i in 1:10_000:100_000
+            fit!(acc, view(x, i:i+9_999), view(y, i:i+9_999))
+        end
+        @test nobs(acc) == length(x)
+        @test covariance(acc) ≈ ref_cov rtol = 1e-6
+        @test pearson_correlation(acc) ≈ pearson_correlation(x, y) rtol = 1e-6
+        intercept, slope = linear_fit(acc)
+        @test slope ≈ ref_cov / ref_var rtol = 1e-6
+        @test intercept ≈ my - slope * mx
+        @test pearson_correlation(fit!(CoMoments{Float64}(), x, y, ntasks=3)) ≈ pearson_correlation(acc)
+        @test all(linear_fit(merge(CoMoments([1, 2], [3, 5]), CoMoments([3], [7]))) .≈ (1, 2))
+        @test_throws DimensionMismatch CoMoments([1, 2], [1])
+    end
+
+    @testset "Statistics: Streaming quantiles" begin
+        rng = MersenneTwister(23)
+        x = randn(rng, 100_000)
+        for p in (0.1, 0.5, 0.9)
+            q = fit!(P2Quantile(p), x)
+            @test nobs(q) == length(x)
+            @test quantile(q) ≈ quantile(x, p) atol = 0.02
+        end
+        # exact for the first values
+        q = fit!(P2Quantile(0.5), [3, 1, 2])
+        @test quantile(q) == 2
+        @test isnan(quantile(P2Quantile(0.5)))
+        @test_throws ArgumentError P2Quantile(1.5)
+    end
+
+    @testset "Statistics: Frequency sketches" begin
+        rng = MersenneTwister(29)
+        x = rand(rng, 1:1000, 100_000)
+        counts = zeros(Int, 1000)
+        for v in x
+            counts[v] += 1
+        end
+        sketch = fit!(CountMinSketch(2^12, 4), x)
+        @test nobs(sketch) == length(x)
+        estimates = [sketch[v] for v in 1:1000]
+        # never below, and rarely far above
+        @test all(estimates .>= counts)
+        @test count(estimates .- counts .> 2 * length(x) / 2^12) <= 10
+        other = fit!(CountMinSketch(2^12, 4), x)
+        @test merge!(other, sketch)[17] == 2 * sketch[17]
+        @test_throws ArgumentError merge!(CountMinSketch(2^10), sketch)
+
+        # three values make half of the stream
+        stream = [rand(rng) < 0.5 ? rand(rng, 1:3) : rand(rng, 4:10^6) for _ in 1:100_000]
+        h = fit!(HeavyHitters{Int}(10), stream)
+        @test sort(first.(topk(h)[1:3])) == [1, 2, 3]
+        @test issorted(last.(topk(h)); rev = true)
+        @test mode(h)[1] in 1:3
+        words = fit!(HeavyHitters{String}(2; width = 64), ["a", "b", "a", "c", "a", "b"])
+        @test first.(topk(words)) == ["a", "b"]
+        @test mode(words) == ["a"]
     end
 
 end
@@ -7,12 +7,62 @@
         @test is_palindrome(s) == false
         s = "Statistics"    # Not a palindrome
         @test is_palindrome(s) == false
-        s = "Stats"    # A palindrome
-        @test is_palindrome(s) == true
-        s = "Racecar"      # A palindrome
-        @test is_palindrome(s) == true
-        x = "Hello"      # Not a palindrome
+        s = "Stats"    # A palindrome, ignoring the case
         @test is_palindrome(s) == false
+        @test is_palindrome(s; ignore_case = true) == true
+        s = "Racecar"      # A palindrome, ignoring the case
+        @test is_palindrome(s; ignore_case = true) == true
+        x = "Hello"      # Not a palindrome
+        @test is_palindrome(x; ignore_case = true) == false
+
+        @test is_palindrome("") == true
+        @test is_palindrome("a") == true
+        @test is_palindrome("été") == true
+        @test is_palindrome("étè") == false
+        @test is_palindrome("aΣba") == false
+        @test is_palindrome("ΣaAΣ"; ignore_case = true) == true
+        @test is_palindrome("σaAΣ"; ignore_case = true) == true
+        @test is_palindrome("A man, a plan, a canal: Panama!") == false
+        @test is_palindrome("A man, a plan, a canal: Panama!"; ignore_case = true, ignore_punctuation = true) == true
+        @test is_palindrome("¡No lemon, no melon!"; ignore_case = true, ignore_punctuation = true) == true
+        @test is_palindrome("Ésope reste ici et se repose"; ignore_case = true, ignore_punctuation = true) == false
+        @test is_palindrome("Ésope reste ici et se reposé"; ignore_case = true, ignore_punctuation = true) == true
+        @test is_palindrome("..!"; ignore_punctuation = true) == true
+        @test is_palindrome(SubString("xxabbayy", 3, 6)) == true
+        @test is_palindrome(codeunits("été")) == false
+        @test is_palindrome([1, 2, 3, 2, 1]) == true
+        check = () -> is_palindrome("A man, a plan, a canal: Panama!"; ignore_case = true, ignore_punctuation = true)
+        check()
+        @test @allocated(check()) == 0
+
+        rng = MersenneTwister(26)
+        words = [String(rand(rng, ['a', 'b', 'é'], rand(rng, 0:6))) for _ in 1:5000]
+        @test is_palindrome.(words) == [w == reverse(w) for w in words]
+        @test map_predicate(is_palindrome, words; ntasks = 4) == [w == reverse(w) for w in words]
+        @test map_predicate(w -> is_palindrome(w; ignore_case = true), uppercase.(words); ntasks = 4) ==
+              [w == reverse(w) for w in words]
+    end
+
+    @testset "Strings: Longest Palindrome" begin
+        @test longest_palindrome("forgeeksskeegfor") == "geeksskeeg"
+        @test longest_palindrome("abacdfgdcaba") == "aba"
+        @test longest_palindrome("cbbd") == "bb"
+        @test longest_palindrome("a") == "a"
+        @test longest_palindrome("") == ""
+        @test longest_palindrome("aéébc") == "éé"
+        @test longest_palindrome("xyzété") == "été"
+        s = "xxabcbayy"
+        @test longest_palindrome(s) isa SubString{String}
+        @test longest_palindrome(SubString(s, 2, 8)) == "abcba"
+
+        # the first of the longest substrings which are palindromes
+        rng = MersenneTwister(26)
+        for _ in 1:500
+            s = String(rand(rng, ['a', 'b', 'c'], rand(rng, 1:30)))
+            n = length(s)
+            best = first(t for len in n:-1:1 for i in 1:n-len+1 for t in (s[i:i+len-1],) if t == reverse(t))
+            @test longest_palindrome(s) == best
+        end
     end
 
 end
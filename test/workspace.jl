@@ -0,0 +1,70 @@
+@testset "Workspace" begin
+    @testset "Workspace: buffers" begin
+        ws = Workspace()
+        a = acquire!(ws, Vector{Int}, 3)
+        b = acquire!(ws, Vector{Int})
+        @test a isa Vector{Int} && length(a) == 3
+        @test isempty(b) && b !== a
+        @test size(acquire!(ws, Matrix{Float64}, 2, 3)) == (2, 3)
+        d = acquire!(ws, Dict{String,Int})
+        d["x"] = 1
+
+        # the same buffers again, emptied or resized
+        @test reset!(ws) === ws
+        @test acquire!(ws, Vector{Int}) === a && isempty(a)
+        @test acquire!(ws, Vector{Int}, 5) === b && length(b) == 5
+        @test acquire!(ws, Dict{String,Int}) === d && isempty(d)
+        @test size(acquire!(ws, Matrix{Float64}, 3, 2)) == (3, 2)
+
+        @test task_workspace() === task_workspace()
+        @test fetch(Threads.@spawn task_workspace()) !== task_workspace()
+    end
+
+    @testset "Workspace: algorithms" begin
+        ws = Workspace()
+        @test prime_factors!(ws, 2560) == prime_factors(2560)
+        @test prime_factors!(ws, 1) == []
+        @test prime_factors!(ws, 1000000007 * 998244353) == [998244353, 1000000007]
+        @test mode!(ws, [3, 4, 5, 3, 4, 2, 5, 2, 2, 4, 4, 4, 2, 2, 4, 2]) == [4, 2]
+        @test mode!(ws, ["x", "x" , "y", "y", "z"]) == ["x", "y"]
+        @test collatz_sequence!(ws, 3) == [3, 10, 5, 16, 8, 4, 2, 1]
+        @test fcfs!(ws, 3, [1, 2, 3], [10, 5, 8]) == ([1, 2, 3], [10, 5, 8], [0, 10, 15], [10, 15, 23], 8.333333333333334, 16.0)
+        A = [2 -1 -2; -4 6 3; -4 -2 8]
+        F = lu_decompose!(ws, A)
+        @test F isa LUWorkspace{Float64}
+        @test F.factors == lu_decompose!(LUWorkspace(A), A).factors
+        @test F.pivots == lu_decompose!(LUWorkspace(A), A).pivots
+        # pivoted, so a zero leading pivot is fine
+        @test determinant(lu_decompose!(ws, [0 1; 1 0])) == -1
+        @test all(isfinite, lu_decompose!(ws, [0 1; 1 0]).factors)
+        @test zero_one_pack!(ws, 10, [1, 3, 11], [20, 5, 80]) == 25
+        @test complete_pack!(ws, 10, [1, 3, 11], [20, 5, 80]) == 200
+
+        # the results are in different buffers until the workspace is reset
+        reset!(ws)
+        x = collatz_sequence!(ws, 3)
+        y = collatz_sequence!(ws, 5)
+        @test x == [3, 10, 5, 16, 8, 4, 2, 1] && y == [5, 16, 8, 4, 2, 1]
+    end
+
+    @testset "Workspace: no allocations" begin
+        ws = Workspace()
+        nums = [3, 4, 5, 3, 4, 2, 5, 2, 2, 4, 4, 4, 2, 2, 4, 2]
+        burst_times = [10, 5, 8]
+        A = rand(MersenneTwister(29), 8, 8)
+        weights, values = [1, 3, 11], [2, 5, 30]
+        hot_path = function ()
+            reset!(ws)
+            prime_factors!(ws, 2560)
+            mode!(ws, nums)
+            collatz_sequence!(ws, 27)
+            fcfs!(ws, 3, 1:3, burst_times)
+            lu_decompose!(ws, A)
+            zero_one_pack!(ws, 20, weights, values)
+            complete_pack!(ws, 20, weights, values)
+            return nothing
+        end
+        hot_path()
+        @test @allocated(hot_path()) == 0
+    end
+end